@@ -0,0 +1,258 @@
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "analytics.h"
+#include "booking_server.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define AN_SSE2 1
+#endif
+
+#define AN_MAX_THREADS 32
+
+int an_push(AN_COLUMN *c, const int *v, int n)
+{
+    if (c->n + n > c->cap) {
+        int cap = c->cap ? c->cap : 1024;
+        int *p;
+        while (cap < c->n + n) cap *= 2;
+        if ((p = (int *)realloc(c->v, (size_t)cap * sizeof(int))) == NULL) return -1;
+        c->v = p; c->cap = cap;
+    }
+    memcpy(c->v + c->n, v, (size_t)n * sizeof(int));
+    c->n += n;
+    return 0;
+}
+
+void an_data_free(AN_DATA *d)
+{
+    AN_COLUMN *cols[] = { &d->sch_id, &d->sch_movie, &d->sch_screen, &d->sch_day, &d->sch_price,
+                          &d->seat_screen, &d->bk_sch };
+    int i;
+    for (i = 0; i < (int)(sizeof(cols) / sizeof(cols[0])); i++) {
+        free(cols[i]->v);
+        cols[i]->v = NULL; cols[i]->n = cols[i]->cap = 0;
+    }
+}
+
+/* dst[i] += src[i] */
+static void add_i32(int *dst, const int *src, int n)
+{
+    int i = 0;
+#ifdef AN_SSE2
+    for (; i + 4 <= n; i += 4) {
+        __m128i a = _mm_loadu_si128((const __m128i *)(dst + i));
+        __m128i b = _mm_loadu_si128((const __m128i *)(src + i));
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_add_epi32(a, b));
+    }
+#endif
+    for (; i < n; i++) dst[i] += src[i];
+}
+
+/*---------------    (帶  ϳ) ----------------------*/
+typedef struct {
+    const int *bk_sch;          /*  尡   */
+    int n;
+    const int *pos;             /* schedule_id ->  ȣ (-1: ) */
+    int max_id;
+    int *count;                 /*  ȣ Ǽ ( ) */
+    long long orphan;
+} COUNT_TASK;
+
+static void count_worker(void *arg)
+{
+    COUNT_TASK *t = (COUNT_TASK *)arg;
+    int i, id, p;
+
+    for (i = 0; i < t->n; i++) {
+        id = t->bk_sch[i];
+        p = (id >= 0 && id <= t->max_id) ? t->pos[id] : -1;
+        if (p >= 0) t->count[p]++;
+        else t->orphan++;
+    }
+}
+
+/*---------------  ----------------------*/
+static int cmp_int(const void *a, const void *b)
+{
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+/* keys[0..n)  ٸ  AN_ROW ϳ (key ) */
+static AN_ROW *make_groups(const int *keys, int n, int *out_n)
+{
+    int *k = (int *)malloc((size_t)(n ? n : 1) * sizeof(int)), i, m = 0;
+    AN_ROW *rows;
+
+    if (k == NULL) return NULL;
+    memcpy(k, keys, (size_t)n * sizeof(int));
+    qsort(k, (size_t)n, sizeof(int), cmp_int);
+    for (i = 0; i < n; i++) if (i == 0 || k[i] != k[i - 1]) k[m++] = k[i];
+    rows = (AN_ROW *)calloc((size_t)(m ? m : 1), sizeof(AN_ROW));
+    if (rows != NULL) for (i = 0; i < m; i++) rows[i].key = k[i];
+    free(k);
+    *out_n = m;
+    return rows;
+}
+
+static AN_ROW *find_group(AN_ROW *rows, int n, int key)
+{
+    int lo = 0, hi = n - 1, mid;
+    while (lo <= hi) {
+        mid = (lo + hi) / 2;
+        if (rows[mid].key == key) return &rows[mid];
+        if (rows[mid].key < key) lo = mid + 1; else hi = mid - 1;
+    }
+    return NULL;
+}
+
+static void add_to(AN_ROW *g, long long seats, long long booked, long long revenue)
+{
+    if (g == NULL) return;
+    g->schedules++; g->seats += seats; g->booked += booked; g->revenue += revenue;
+}
+
+int an_aggregate(const AN_DATA *d, int threads, AN_REPORT *out)
+{
+    int nsch = d->sch_id.n, max_id = 0, max_screen = 0, i, t, chunk, ok;
+    int *pos, *booked, *seats_of_screen;
+    COUNT_TASK task[AN_MAX_THREADS];
+    bk_thread_t th[AN_MAX_THREADS];
+    int started[AN_MAX_THREADS];
+    double t0 = bk_now_ms();
+
+    memset(out, 0, sizeof(*out));
+    memset(task, 0, sizeof(task));
+    if (threads < 1) threads = 1;
+    if (threads > AN_MAX_THREADS) threads = AN_MAX_THREADS;
+
+    for (i = 0; i < nsch; i++) {
+        if (d->sch_id.v[i] > max_id) max_id = d->sch_id.v[i];
+        if (d->sch_screen.v[i] > max_screen) max_screen = d->sch_screen.v[i];
+    }
+    for (i = 0; i < d->seat_screen.n; i++) if (d->seat_screen.v[i] > max_screen) max_screen = d->seat_screen.v[i];
+
+    pos = (int *)malloc(((size_t)max_id + 1) * sizeof(int));
+    seats_of_screen = (int *)calloc((size_t)max_screen + 1, sizeof(int));
+    booked = (int *)calloc((size_t)nsch + 1, sizeof(int));
+    ok = pos != NULL && seats_of_screen != NULL && booked != NULL;
+    for (t = 0; t < threads && ok; t++) ok = (task[t].count = (int *)calloc((size_t)nsch + 1, sizeof(int))) != NULL;
+
+    if (ok) {
+        /* schedule_id ->  ȣ (ID  迭 ٷ ã) */
+        memset(pos, 0xff, ((size_t)max_id + 1) * sizeof(int));
+        for (i = 0; i < nsch; i++) if (d->sch_id.v[i] >= 0) pos[d->sch_id.v[i]] = i;
+
+        /* 󿵰 ¼  */
+        for (i = 0; i < d->seat_screen.n; i++) if (d->seat_screen.v[i] >= 0) seats_of_screen[d->seat_screen.v[i]]++;
+
+        /*    ŭ  . 0   尡  */
+        chunk = (d->bk_sch.n + threads - 1) / threads;
+        for (t = 0; t < threads; t++) {
+            int from = t * chunk, to = from + chunk;
+            if (to > d->bk_sch.n) to = d->bk_sch.n;
+            task[t].bk_sch = d->bk_sch.v + (from < to ? from : 0);
+            task[t].n = from < to ? to - from : 0;
+            task[t].pos = pos; task[t].max_id = max_id;
+        }
+        for (t = 1; t < threads; t++) {
+            started[t] = bk_thread_start(&th[t], count_worker, &task[t]) == 0;
+            if (!started[t]) count_worker(&task[t]);
+        }
+        count_worker(&task[0]);
+        for (t = 1; t < threads; t++) if (started[t]) bk_thread_join(th[t]);
+        for (t = 0; t < threads; t++) {
+            add_i32(booked, task[t].count, nsch);
+            out->bookings_orphan += task[t].orphan;
+        }
+        out->bookings_scanned = d->bk_sch.n;
+
+        /*   ȭ / 󿵰 / ¥  */
+        out->movie  = make_groups(d->sch_movie.v, nsch, &out->n_movie);
+        out->screen = make_groups(d->sch_screen.v, nsch, &out->n_screen);
+        out->day    = make_groups(d->sch_day.v, nsch, &out->n_day);
+        ok = out->movie != NULL && out->screen != NULL && out->day != NULL;
+    }
+    for (i = 0; i < nsch && ok; i++) {
+        long long seats = d->sch_screen.v[i] >= 0 ? seats_of_screen[d->sch_screen.v[i]] : 0;
+        long long revenue = (long long)booked[i] * d->sch_price.v[i];
+        add_to(find_group(out->movie, out->n_movie, d->sch_movie.v[i]), seats, booked[i], revenue);
+        add_to(find_group(out->screen, out->n_screen, d->sch_screen.v[i]), seats, booked[i], revenue);
+        add_to(find_group(out->day, out->n_day, d->sch_day.v[i]), seats, booked[i], revenue);
+    }
+
+    for (t = 0; t < threads; t++) free(task[t].count);
+    free(pos); free(booked); free(seats_of_screen);
+    out->aggregate_ms = bk_now_ms() - t0;
+    if (!ok) { an_report_free(out); return -1; }
+    return 0;
+}
+
+void an_report_free(AN_REPORT *r)
+{
+    free(r->movie); free(r->screen); free(r->day);
+    r->movie = r->screen = r->day = NULL;
+    r->n_movie = r->n_screen = r->n_day = 0;
+}
+
+/*---------------  ----------------------*/
+static double pct(const AN_ROW *g)
+{
+    return g->seats ? 100.0 * (double)g->booked / (double)g->seats : 0.0;
+}
+
+static void print_section(FILE *fp, const char *title, const AN_ROW *rows, int n, const char *(*label)(int))
+{
+    const char *name;
+    int i;
+
+    fprintf(fp, "\n [%s]\n", title);
+    fprintf(fp, " %-28s %6s %9s %9s %7s %14s\n", "", "", "¼", "", "", "()");
+    for (i = 0; i < n; i++) {
+        name = label ? label(rows[i].key) : NULL;
+        if (name != NULL) fprintf(fp, " %4d %-23.23s", rows[i].key, name);
+        else fprintf(fp, " %-28d", rows[i].key);
+        fprintf(fp, " %6d %9lld %9lld %6.1f%% %14lld\n", rows[i].schedules, rows[i].seats, rows[i].booked, pct(&rows[i]), rows[i].revenue);
+    }
+}
+
+void an_print(const AN_REPORT *r, FILE *fp, const char *(*movie_title)(int movie_id))
+{
+    print_section(fp, "ȭ", r->movie, r->n_movie, movie_title);
+    print_section(fp, "󿵰", r->screen, r->n_screen, NULL);
+    print_section(fp, "¥", r->day, r->n_day, NULL);
+    fprintf(fp, "\n  %lld  (   %lld), %.1fms\n", r->bookings_scanned, r->bookings_orphan, r->aggregate_ms);
+}
+
+static void csv_section(FILE *fp, const char *kind, const AN_ROW *rows, int n, const char *(*label)(int))
+{
+    const char *name, *s;
+    int i;
+
+    for (i = 0; i < n; i++) {
+        name = label ? label(rows[i].key) : NULL;
+        fprintf(fp, "%s,%d,\"", kind, rows[i].key);
+        for (s = name ? name : ""; *s; s++) {
+            if (*s == '"') fputc('"', fp);
+            fputc(*s, fp);
+        }
+        fprintf(fp, "\",%d,%lld,%lld,%.2f,%lld\n", rows[i].schedules, rows[i].seats, rows[i].booked, pct(&rows[i]), rows[i].revenue);
+    }
+}
+
+int an_write_csv(const AN_REPORT *r, const char *path, const char *(*movie_title)(int movie_id))
+{
+    FILE *fp = fopen(path, "w");
+    if (fp == NULL) return -1;
+    fprintf(fp, "kind,key,name,schedules,seats,booked,occupancy_pct,revenue\n");
+    csv_section(fp, "movie", r->movie, r->n_movie, movie_title);
+    csv_section(fp, "screen", r->screen, r->n_screen, NULL);
+    csv_section(fp, "day", r->day, r->n_day, NULL);
+    fclose(fp);
+    return 0;
+}
@@ -0,0 +1,51 @@
+#ifndef ANALYTICS_H
+#define ANALYTICS_H
+
+#include <stdio.h>
+
+/*
+ * /  ( )
+ *  - DB 迭 FETCH   (column)  迭 ׾ ΰ ޸𸮿  (GROUP BY )
+ *  -   帶    Ǽ , 庰  SSE2  ħ
+ *  -  (¼ ,  , ) ȭ / 󿵰 / ¥  ǥ CSV 
+ */
+
+typedef struct {
+    int  n, cap;
+    int *v;
+} AN_COLUMN;
+
+typedef struct {
+    AN_COLUMN sch_id, sch_movie, sch_screen, sch_day, sch_price;   /* Schedules (day = YYYYMMDD) */
+    AN_COLUMN seat_screen;                                          /* Seats */
+    AN_COLUMN bk_sch;                                               /* Ϸ Bookings schedule_id */
+} AN_DATA;
+
+typedef struct {
+    int key;                    /* movie_id / screen_no / YYYYMMDD */
+    int schedules;
+    long long seats;            /* Ǹ  ¼ (󿵰 ¼  x  ) */
+    long long booked;
+    long long revenue;
+} AN_ROW;
+
+typedef struct {
+    AN_ROW *movie;  int n_movie;
+    AN_ROW *screen; int n_screen;
+    AN_ROW *day;    int n_day;
+    long long bookings_scanned;
+    long long bookings_orphan;  /*   ã  */
+    double    aggregate_ms;
+} AN_REPORT;
+
+int  an_push(AN_COLUMN *c, const int *v, int n);        /* ڿ n . ޸ ̸ -1 */
+void an_data_free(AN_DATA *d);
+
+int  an_aggregate(const AN_DATA *d, int threads, AN_REPORT *out);
+void an_report_free(AN_REPORT *r);
+
+/* movie_title: movie_id ->  (NULL̸ ID) */
+void an_print(const AN_REPORT *r, FILE *fp, const char *(*movie_title)(int movie_id));
+int  an_write_csv(const AN_REPORT *r, const char *path, const char *(*movie_title)(int movie_id));
+
+#endif
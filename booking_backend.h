@@ -0,0 +1,51 @@
+#ifndef BOOKING_BACKEND_H
+#define BOOKING_BACKEND_H
+
+/*
+ *  鿣 ̽
+ *  -   Ŀ  Լ ͵鸸 ȣ
+ *  - dao_backend : CINEMA_DAO(cinema_dao.h)   ϳ. (proc_dao / embedded_dao) dao_backend_use 
+ */
+
+/*  ڵ */
+#define BK_OK           0
+#define BK_NO_USER      1   /*  ȸ */
+#define BK_NO_SCHEDULE  2   /*   */
+#define BK_BAD_SEAT     3   /*  󿵰 ¼ ƴ */
+#define BK_SEAT_TAKEN   4   /* ̹  ¼ */
+#define BK_NOT_OWNER    5   /*   ƴ */
+#define BK_HOLD_EXPIRED 6   /* ¼ () ð   */
+#define BK_DUP_KEY      7   /* PK ߺ */
+#define BK_CHECK        8   /* CHECK   (ó ,  ð, ,  ) */
+#define BK_NO_MOVIE     9   /*  ȭ */
+#define BK_CONFLICT    10   /*  ڿ ٸ  Ű ٲ (ٽ а õ) */
+#define BK_DB_ERROR    -1
+
+#define BK_MAX_LIST 50
+
+typedef struct {
+    int  booking_id;
+    int  schedule_id;
+    int  seat_id;
+    char status[20];
+} BK_BOOKING;
+
+typedef struct {
+    const char *name;
+    void *(*open)(void);                /* () ϳ ,   NULL */
+    void  (*close)(void *sess);
+    int   (*book)(void *sess, int uid, int sid, int seat_id, int *out_bid);
+    int   (*change)(void *sess, int uid, int bid, int new_sid, int new_seat_id);
+    int   (*cancel)(void *sess, int uid, int bid);
+    int   (*list)(void *sess, int uid, BK_BOOKING *rows, int max);    /*  ,   BK_DB_ERROR */
+} BOOKING_BACKEND;
+
+const char *bk_status_text(int status);
+
+/* dao_backend.c */
+extern BOOKING_BACKEND dao_backend;
+
+/* local_backend.c:     ͸   dao_backend   */
+int local_backend_init(int users, int schedules, int screens, int seats_per_screen);
+
+#endif
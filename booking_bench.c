@@ -0,0 +1,379 @@
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "booking_server.h"
+
+#ifndef _WIN32
+#include <time.h>
+#endif
+
+/*
+ *   ߻ (open-loop)
+ *  - û i "  ð" = t0 + i / rate. Ŀ  ð ٷȴٰ 
+ *  -  ð  ð  (coordinated omission ).
+ *     и  û  ״ .  ۺ   ð  
+ *  - ۾ (book/change/cancel/list) α  (Zipf s)  
+ *  - ó з (duration + grace)     û  ʰ dropped .
+ *    ̶   ٸ ð  
+ *
+ * / (, Oracle ʿ):
+ *   gcc -O2 -pthread booking_bench.c booking_server.c dao_backend.c local_backend.c embedded_db.c -lm -o booking_bench
+ *   ./booking_bench -r 20000 -d 10 -t 8 -m 60,10,10,20 -z 1.1
+ */
+
+/*--------------- HDR  ׷ ----------------------*/
+/* (ns) 2 ŵ  ,   ٽ SUB_BUCKETS  (  < 1%) */
+#define SUB_BITS    7
+#define SUB_BUCKETS (1 << SUB_BITS)
+#define MAG_COUNT   32
+
+typedef struct {
+    long long counts[MAG_COUNT][SUB_BUCKETS];
+    long long total;
+    long long max;
+} HISTOGRAM;
+
+static void hist_record(HISTOGRAM *h, long long v)
+{
+    int mag = 0;
+    long long sub;
+
+    if (v < 0) v = 0;
+    while ((v >> mag) >= SUB_BUCKETS && mag < MAG_COUNT - 1) mag++;
+    sub = v >> mag;
+    if (sub >= SUB_BUCKETS) sub = SUB_BUCKETS - 1;
+    h->counts[mag][sub]++;
+    h->total++;
+    if (v > h->max) h->max = v;
+}
+
+static void hist_merge(HISTOGRAM *dst, const HISTOGRAM *src)
+{
+    int m, s;
+    for (m = 0; m < MAG_COUNT; m++)
+        for (s = 0; s < SUB_BUCKETS; s++) dst->counts[m][s] += src->counts[m][s];
+    dst->total += src->total;
+    if (src->max > dst->max) dst->max = src->max;
+}
+
+/* q (0~1)  .    */
+static long long hist_percentile(const HISTOGRAM *h, double q)
+{
+    long long want = (long long)ceil(q * h->total), seen = 0;
+    int m, s;
+
+    if (h->total == 0) return 0;
+    if (want < 1) want = 1;
+    for (m = 0; m < MAG_COUNT; m++) {
+        for (s = (m == 0 ? 0 : SUB_BUCKETS / 2); s < SUB_BUCKETS; s++) {
+            seen += h->counts[m][s];
+            if (seen >= want) return ((long long)(s + 1) << m) - 1 < h->max ? ((long long)(s + 1) << m) - 1 : h->max;
+        }
+    }
+    return h->max;
+}
+
+/*---------------  ----------------------*/
+#define NOPS 4
+static const char *op_name[NOPS] = { "book", "change", "cancel", "list" };
+
+typedef struct {
+    double rate;            /* ʴ û  (ü) */
+    double duration;        /*  */
+    int    threads;
+    int    users, schedules, screens, seats;
+    double zipf_s;          /* 0̸ յ */
+    double grace;           /* , ⺻ = duration */
+    int    mix[NOPS];       /*  ( 100 ʿ ) */
+    int    pool;
+} BENCH_CONFIG;
+
+/*---------------   ----------------------*/
+#define MAX_THREADS 64
+#define RECENT_SIZE 65536   /* change/cancel   ֱ  */
+
+typedef struct {
+    HISTOGRAM latency[NOPS];    /*  ð  () */
+    HISTOGRAM service[NOPS];    /*    */
+    long long ok[NOPS], conflict[NOPS], stale[NOPS], error[NOPS], dropped[NOPS];
+    unsigned long long rng;
+} WORKER_STATE;
+
+static struct {
+    BENCH_CONFIG cfg;
+    SESSION_POOL pool;
+    double t0_ms;
+    long long total_requests;
+    bk_mutex_t lock;
+    long long next_seq;             /*  û ȣ */
+    int recent_uid[RECENT_SIZE];
+    int recent_bid[RECENT_SIZE];
+    long long recent_n;
+    double *zipf_cdf;
+    int mix_total;
+    WORKER_STATE ws[MAX_THREADS];
+} B;
+
+static unsigned long long rnd(unsigned long long *s)
+{
+    unsigned long long x = *s;
+    x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+    return *s = x;
+}
+
+static double rnd01(unsigned long long *s) { return (rnd(s) >> 11) * (1.0 / 9007199254740992.0); }
+
+static void build_zipf(int n, double s)
+{
+    double sum = 0;
+    int i;
+    B.zipf_cdf = (double *)malloc(sizeof(double) * n);
+    for (i = 0; i < n; i++) { sum += (s > 0) ? 1.0 / pow(i + 1, s) : 1.0; B.zipf_cdf[i] = sum; }
+    for (i = 0; i < n; i++) B.zipf_cdf[i] /= sum;
+}
+
+/* α  1  1 */
+static int pick_schedule(unsigned long long *rng)
+{
+    double u = rnd01(rng);
+    int lo = 0, hi = B.cfg.schedules - 1, mid;
+    while (lo < hi) {
+        mid = (lo + hi) / 2;
+        if (B.zipf_cdf[mid] < u) lo = mid + 1; else hi = mid;
+    }
+    return lo + 1;
+}
+
+static int pick_op(unsigned long long *rng)
+{
+    int r = (int)(rnd(rng) % (unsigned)B.mix_total), i;
+    for (i = 0; i < NOPS; i++) { if (r < B.cfg.mix[i]) return i; r -= B.cfg.mix[i]; }
+    return 0;
+}
+
+static void remember_booking(int uid, int bid)
+{
+    bk_mutex_lock(&B.lock);
+    B.recent_uid[B.recent_n % RECENT_SIZE] = uid;
+    B.recent_bid[B.recent_n % RECENT_SIZE] = bid;
+    B.recent_n++;
+    bk_mutex_unlock(&B.lock);
+}
+
+static int pick_booking(unsigned long long *rng, int *uid, int *bid)
+{
+    long long n, i;
+    bk_mutex_lock(&B.lock);
+    n = B.recent_n < RECENT_SIZE ? B.recent_n : RECENT_SIZE;
+    if (n == 0) { bk_mutex_unlock(&B.lock); return 0; }
+    i = (long long)(rnd(rng) % (unsigned long long)n);
+    *uid = B.recent_uid[i]; *bid = B.recent_bid[i];
+    bk_mutex_unlock(&B.lock);
+    return 1;
+}
+
+static void sleep_until(double t_ms)
+{
+    double d;
+    while ((d = t_ms - bk_now_ms()) > 0) {
+#ifdef _WIN32
+        if (d > 2) Sleep((DWORD)(d - 1));
+#else
+        struct timespec ts;
+        if (d > 0.2) {
+            d -= 0.1;
+            ts.tv_sec = (time_t)(d / 1000);
+            ts.tv_nsec = (long)((d - ts.tv_sec * 1000.0) * 1e6);
+            nanosleep(&ts, NULL);
+        }
+#endif
+    }
+}
+
+static void run_one(WORKER_STATE *w, int op, void *sess)
+{
+    BOOKING_BACKEND *be = B.pool.be;
+    BK_BOOKING rows[BK_MAX_LIST];
+    int uid, sid, seat, bid, rc, screen;
+
+    sid = pick_schedule(&w->rng);
+    screen = (sid - 1) % B.cfg.screens + 1;
+    seat = (screen - 1) * B.cfg.seats + 1 + (int)(rnd(&w->rng) % (unsigned)B.cfg.seats);
+    uid = 1 + (int)(rnd(&w->rng) % (unsigned)B.cfg.users);
+
+    switch (op) {
+        case 0:
+            rc = be->book(sess, uid, sid, seat, &bid);
+            if (rc == BK_OK) remember_booking(uid, bid);
+            break;
+        case 1:
+            rc = pick_booking(&w->rng, &uid, &bid) ? be->change(sess, uid, bid, sid, seat) : BK_NOT_OWNER;
+            break;
+        case 2:
+            rc = pick_booking(&w->rng, &uid, &bid) ? be->cancel(sess, uid, bid) : BK_NOT_OWNER;
+            break;
+        default:
+            rc = be->list(sess, uid, rows, BK_MAX_LIST);
+            if (rc > 0) rc = BK_OK;
+            break;
+    }
+
+    if (rc == BK_OK) w->ok[op]++;
+    else if (rc == BK_SEAT_TAKEN) w->conflict[op]++;
+    else if (rc == BK_NOT_OWNER) w->stale[op]++;      /* ̹ /  */
+    else w->error[op]++;
+}
+
+static void bench_worker(void *arg)
+{
+    WORKER_STATE *w = (WORKER_STATE *)arg;
+    double interval = 1000.0 / B.cfg.rate, intended, start, end;
+    double deadline = B.t0_ms + (B.cfg.duration + B.cfg.grace) * 1000.0;
+    long long seq;
+    int op, slot;
+
+    for (;;) {
+        bk_mutex_lock(&B.lock);
+        seq = B.next_seq++;
+        bk_mutex_unlock(&B.lock);
+        if (seq >= B.total_requests) break;
+
+        intended = B.t0_ms + seq * interval;
+        sleep_until(intended);
+        op = pick_op(&w->rng);
+
+        if ((start = bk_now_ms()) > deadline) {
+            w->dropped[op]++;
+            hist_record(&w->latency[op], (long long)((start - intended) * 1e6));
+            continue;
+        }
+
+        slot = pool_checkout(&B.pool);
+        run_one(w, op, B.pool.sess[slot]);
+        pool_checkin(&B.pool, slot);
+        end = bk_now_ms();
+
+        hist_record(&w->latency[op], (long long)((end - intended) * 1e6));
+        hist_record(&w->service[op], (long long)((end - start) * 1e6));
+    }
+}
+
+static void parse_mix(const char *s, int *mix)
+{
+    int i;
+    for (i = 0; i < NOPS; i++) mix[i] = 0;
+    sscanf(s, "%d,%d,%d,%d", &mix[0], &mix[1], &mix[2], &mix[3]);
+}
+
+static void usage(void)
+{
+    fprintf(stderr,
+        "usage: booking_bench [-r rate/s] [-d seconds] [-g grace_seconds] [-t threads] [-p pool]\n"
+        "                     [-u users] [-S schedules] [-c screens] [-s seats/screen]\n"
+        "                     [-z zipf_s] [-m book,change,cancel,list]\n");
+}
+
+static void print_hist_row(const char *name, const HISTOGRAM *h)
+{
+    printf("  %-14s %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f\n", name,
+           hist_percentile(h, 0.50) / 1000.0, hist_percentile(h, 0.90) / 1000.0, hist_percentile(h, 0.99) / 1000.0,
+           hist_percentile(h, 0.999) / 1000.0, hist_percentile(h, 0.9999) / 1000.0, h->max / 1000.0);
+}
+
+int main(int argc, char *argv[])
+{
+    static HISTOGRAM lat[NOPS], svc[NOPS], lat_all, svc_all;
+    long long ok = 0, conflict = 0, stale = 0, error = 0, dropped = 0, n_op;
+    bk_thread_t th[MAX_THREADS];
+    double elapsed;
+    char name[32];
+    int i, j;
+
+    B.cfg.rate = 5000; B.cfg.duration = 5; B.cfg.threads = 8; B.cfg.pool = 8;
+    B.cfg.users = 100000; B.cfg.schedules = 200; B.cfg.screens = 10; B.cfg.seats = 150;
+    B.cfg.zipf_s = 1.0;
+    B.cfg.grace = -1;
+    parse_mix("60,10,10,20", B.cfg.mix);
+
+    for (i = 1; i + 1 < argc; i += 2) {
+        if      (strcmp(argv[i], "-r") == 0) B.cfg.rate = atof(argv[i + 1]);
+        else if (strcmp(argv[i], "-d") == 0) B.cfg.duration = atof(argv[i + 1]);
+        else if (strcmp(argv[i], "-g") == 0) B.cfg.grace = atof(argv[i + 1]);
+        else if (strcmp(argv[i], "-t") == 0) B.cfg.threads = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "-p") == 0) B.cfg.pool = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "-u") == 0) B.cfg.users = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "-S") == 0) B.cfg.schedules = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "-c") == 0) B.cfg.screens = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "-s") == 0) B.cfg.seats = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "-z") == 0) B.cfg.zipf_s = atof(argv[i + 1]);
+        else if (strcmp(argv[i], "-m") == 0) parse_mix(argv[i + 1], B.cfg.mix);
+        else { usage(); return 1; }
+    }
+    if (i < argc) { usage(); return 1; }
+    if (B.cfg.grace < 0) B.cfg.grace = B.cfg.duration;
+    if (B.cfg.threads < 1) B.cfg.threads = 1;
+    if (B.cfg.threads > MAX_THREADS) B.cfg.threads = MAX_THREADS;
+    for (i = 0, B.mix_total = 0; i < NOPS; i++) B.mix_total += B.cfg.mix[i];
+    if (B.cfg.rate <= 0 || B.cfg.duration <= 0 || B.mix_total <= 0 || B.cfg.screens < 1 || B.cfg.schedules < 1) { usage(); return 1; }
+
+    if (local_backend_init(B.cfg.users, B.cfg.schedules, B.cfg.screens, B.cfg.seats) != 0) return 1;
+    if (pool_create(&B.pool, &dao_backend, B.cfg.pool) == 0) return 1;
+    bk_mutex_init(&B.lock);
+    build_zipf(B.cfg.schedules, B.cfg.zipf_s);
+    B.total_requests = (long long)(B.cfg.rate * B.cfg.duration);
+
+    printf("backend=%s rate=%.0f/s duration=%.0fs threads=%d pool=%d users=%d schedules=%d screens=%d seats=%d zipf=%.2f mix=%d/%d/%d/%d\n",
+           B.pool.be->name, B.cfg.rate, B.cfg.duration, B.cfg.threads, B.pool.size, B.cfg.users, B.cfg.schedules,
+           B.cfg.screens, B.cfg.seats, B.cfg.zipf_s, B.cfg.mix[0], B.cfg.mix[1], B.cfg.mix[2], B.cfg.mix[3]);
+
+    B.t0_ms = bk_now_ms() + 10;
+    for (i = 0; i < B.cfg.threads; i++) {
+        B.ws[i].rng = 0x9E3779B97F4A7C15ULL * (i + 1);
+        bk_thread_start(&th[i], bench_worker, &B.ws[i]);
+    }
+    for (i = 0; i < B.cfg.threads; i++) bk_thread_join(th[i]);
+    elapsed = (bk_now_ms() - B.t0_ms) / 1000.0;
+
+    for (i = 0; i < B.cfg.threads; i++) {
+        for (j = 0; j < NOPS; j++) {
+            hist_merge(&lat[j], &B.ws[i].latency[j]);
+            hist_merge(&svc[j], &B.ws[i].service[j]);
+        }
+    }
+
+    printf("\n%-8s %10s %10s %10s %10s %10s %10s\n", "op", "count", "ok", "conflict", "stale", "error", "dropped");
+    for (j = 0; j < NOPS; j++) {
+        long long o = 0, c = 0, s = 0, e = 0, d = 0;
+        for (i = 0; i < B.cfg.threads; i++) {
+            o += B.ws[i].ok[j]; c += B.ws[i].conflict[j]; s += B.ws[i].stale[j]; e += B.ws[i].error[j]; d += B.ws[i].dropped[j];
+        }
+        n_op = o + c + s + e;
+        printf("%-8s %10lld %10lld %10lld %10lld %10lld %10lld\n", op_name[j], n_op, o, c, s, e, d);
+        ok += o; conflict += c; stale += s; error += e; dropped += d;
+        hist_merge(&lat_all, &lat[j]);
+        hist_merge(&svc_all, &svc[j]);
+    }
+    n_op = ok + conflict + stale + error;
+    printf("\nthroughput: %.0f req/s (target %.0f), elapsed %.2fs\n", n_op / elapsed, B.cfg.rate, elapsed);
+    printf("conflict rate: %.2f%% of book+change\n", 100.0 * conflict /
+           (double)((svc[0].total + svc[1].total) ? (svc[0].total + svc[1].total) : 1));
+    if (dropped > 0) printf("dropped: %lld requests not started within duration + %.0fs grace\n", dropped, B.cfg.grace);
+
+    printf("\nlatency (us, from intended start / coordinated-omission corrected)\n");
+    printf("  %-14s %10s %10s %10s %10s %10s %10s\n", "", "p50", "p90", "p99", "p99.9", "p99.99", "max");
+    for (j = 0; j < NOPS; j++) print_hist_row(op_name[j], &lat[j]);
+    print_hist_row("all", &lat_all);
+
+    printf("\nservice time (us, from actual start)\n");
+    for (j = 0; j < NOPS; j++) { sprintf(name, "%s", op_name[j]); print_hist_row(name, &svc[j]); }
+    print_hist_row("all", &svc_all);
+
+    printf("\n");
+    pool_print_stats(&B.pool);
+    pool_destroy(&B.pool);
+    return 0;
+}
@@ -0,0 +1,323 @@
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "booking_server.h"
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <time.h>
+#endif
+
+/*--------------- /  ----------------------*/
+#ifdef _WIN32
+void bk_mutex_init(bk_mutex_t *m)   { InitializeCriticalSection(m); }
+void bk_mutex_lock(bk_mutex_t *m)   { EnterCriticalSection(m); }
+void bk_mutex_unlock(bk_mutex_t *m) { LeaveCriticalSection(m); }
+void bk_cond_init(bk_cond_t *c)     { InitializeConditionVariable(c); }
+void bk_cond_wait(bk_cond_t *c, bk_mutex_t *m) { SleepConditionVariableCS(c, m, INFINITE); }
+void bk_cond_signal(bk_cond_t *c)   { WakeConditionVariable(c); }
+void bk_cond_broadcast(bk_cond_t *c) { WakeAllConditionVariable(c); }
+
+typedef struct { void (*fn)(void *); void *arg; } THREAD_START;
+
+static unsigned __stdcall thread_tramp(void *p)
+{
+    THREAD_START ts = *(THREAD_START *)p;
+    free(p);
+    ts.fn(ts.arg);
+    return 0;
+}
+
+int bk_thread_start(bk_thread_t *t, void (*fn)(void *), void *arg)
+{
+    THREAD_START *ts = (THREAD_START *)malloc(sizeof(THREAD_START));
+    if (ts == NULL) return -1;
+    ts->fn = fn; ts->arg = arg;
+    *t = (HANDLE)_beginthreadex(NULL, 0, thread_tramp, ts, 0, NULL);
+    if (*t == 0) { free(ts); return -1; }
+    return 0;
+}
+
+void bk_thread_join(bk_thread_t t) { WaitForSingleObject(t, INFINITE); CloseHandle(t); }
+
+double bk_now_ms(void)
+{
+    static LARGE_INTEGER freq;
+    LARGE_INTEGER now;
+    if (freq.QuadPart == 0) QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    return (double)now.QuadPart * 1000.0 / (double)freq.QuadPart;
+}
+#else
+void bk_mutex_init(bk_mutex_t *m)   { pthread_mutex_init(m, NULL); }
+void bk_mutex_lock(bk_mutex_t *m)   { pthread_mutex_lock(m); }
+void bk_mutex_unlock(bk_mutex_t *m) { pthread_mutex_unlock(m); }
+void bk_cond_init(bk_cond_t *c)     { pthread_cond_init(c, NULL); }
+void bk_cond_wait(bk_cond_t *c, bk_mutex_t *m) { pthread_cond_wait(c, m); }
+void bk_cond_signal(bk_cond_t *c)   { pthread_cond_signal(c); }
+void bk_cond_broadcast(bk_cond_t *c) { pthread_cond_broadcast(c); }
+
+typedef struct { void (*fn)(void *); void *arg; } THREAD_START;
+
+static void *thread_tramp(void *p)
+{
+    THREAD_START ts = *(THREAD_START *)p;
+    free(p);
+    ts.fn(ts.arg);
+    return NULL;
+}
+
+int bk_thread_start(bk_thread_t *t, void (*fn)(void *), void *arg)
+{
+    THREAD_START *ts = (THREAD_START *)malloc(sizeof(THREAD_START));
+    if (ts == NULL) return -1;
+    ts->fn = fn; ts->arg = arg;
+    if (pthread_create(t, NULL, thread_tramp, ts) != 0) { free(ts); return -1; }
+    return 0;
+}
+
+void bk_thread_join(bk_thread_t t) { pthread_join(t, NULL); }
+
+double bk_now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+#endif
+
+const char *bk_status_text(int status)
+{
+    switch (status) {
+        case BK_OK:          return "OK";
+        case BK_NO_USER:     return "NO_USER";
+        case BK_NO_SCHEDULE: return "NO_SCHEDULE";
+        case BK_BAD_SEAT:    return "BAD_SEAT";
+        case BK_SEAT_TAKEN:  return "SEAT_TAKEN";
+        case BK_NOT_OWNER:   return "NOT_OWNER";
+        case BK_HOLD_EXPIRED: return "HOLD_EXPIRED";
+        case BK_DUP_KEY:     return "DUP_KEY";
+        case BK_CHECK:       return "CHECK";
+        case BK_NO_MOVIE:    return "NO_MOVIE";
+        case BK_CONFLICT:    return "CONFLICT";
+        default:             return "DB_ERROR";
+    }
+}
+
+/*---------------  Ǯ ----------------------*/
+int pool_create(SESSION_POOL *p, BOOKING_BACKEND *be, int size)
+{
+    int i;
+    memset(p, 0, sizeof(*p));
+    if (size < 1) size = 1;
+    if (size > POOL_MAX) size = POOL_MAX;
+    p->be = be;
+    bk_mutex_init(&p->lock);
+    bk_cond_init(&p->cond);
+    for (i = 0; i < size; i++) {
+        if ((p->sess[i] = be->open()) == NULL) break;
+        p->born_ms[i] = bk_now_ms();
+        p->free_slot[p->nfree++] = i;
+    }
+    p->size = i;
+    return p->size;
+}
+
+void pool_destroy(SESSION_POOL *p)
+{
+    int i;
+    for (i = 0; i < p->size; i++) p->be->close(p->sess[i]);
+    p->size = p->nfree = 0;
+}
+
+int pool_checkout(SESSION_POOL *p)
+{
+    double t0;
+    int slot;
+
+    bk_mutex_lock(&p->lock);
+    if (p->nfree == 0) {
+        p->waits++;
+        t0 = bk_now_ms();
+        while (p->nfree == 0) bk_cond_wait(&p->cond, &p->lock);
+        p->wait_ms += bk_now_ms() - t0;
+    }
+    slot = p->free_slot[--p->nfree];
+    p->checkouts++;
+    bk_mutex_unlock(&p->lock);
+    return slot;
+}
+
+void pool_checkin(SESSION_POOL *p, int slot)
+{
+    bk_mutex_lock(&p->lock);
+    p->free_slot[p->nfree++] = slot;
+    bk_cond_signal(&p->cond);
+    bk_mutex_unlock(&p->lock);
+}
+
+void pool_print_stats(SESSION_POOL *p)
+{
+    double now = bk_now_ms(), age, min_age = 0, max_age = 0, sum_age = 0;
+    int i;
+
+    bk_mutex_lock(&p->lock);
+    for (i = 0; i < p->size; i++) {
+        age = (now - p->born_ms[i]) / 1000.0;
+        if (i == 0 || age < min_age) min_age = age;
+        if (age > max_age) max_age = age;
+        sum_age += age;
+    }
+    printf("[POOL] backend=%s size=%d free=%d checkouts=%ld waits=%ld wait_avg=%.3fms age(s) min=%.1f avg=%.1f max=%.1f\n",
+           p->be->name, p->size, p->nfree, p->checkouts, p->waits,
+           p->waits ? p->wait_ms / p->waits : 0.0,
+           min_age, p->size ? sum_age / p->size : 0.0, max_age);
+    bk_mutex_unlock(&p->lock);
+}
+
+/*--------------- û ť + Ŀ ----------------------*/
+#define QUEUE_SIZE 1024
+#define MAX_WORKERS 64
+
+typedef struct {
+    bk_mutex_t lock;
+    bk_cond_t  not_empty, not_full;
+    BK_REQUEST q[QUEUE_SIZE];
+    int head, tail, count;
+    int closed;
+} REQUEST_QUEUE;
+
+typedef struct {
+    REQUEST_QUEUE queue;
+    SESSION_POOL  pool;
+    bk_mutex_t    out_lock;         /*    ʵ */
+} BOOKING_SERVER;
+
+static void queue_push(REQUEST_QUEUE *q, BK_REQUEST *r)
+{
+    bk_mutex_lock(&q->lock);
+    while (q->count == QUEUE_SIZE) bk_cond_wait(&q->not_full, &q->lock);
+    q->q[q->tail] = *r;
+    q->tail = (q->tail + 1) % QUEUE_SIZE;
+    q->count++;
+    bk_cond_signal(&q->not_empty);
+    bk_mutex_unlock(&q->lock);
+}
+
+/* ť   0 */
+static int queue_pop(REQUEST_QUEUE *q, BK_REQUEST *r)
+{
+    bk_mutex_lock(&q->lock);
+    while (q->count == 0 && !q->closed) bk_cond_wait(&q->not_empty, &q->lock);
+    if (q->count == 0) { bk_mutex_unlock(&q->lock); return 0; }
+    *r = q->q[q->head];
+    q->head = (q->head + 1) % QUEUE_SIZE;
+    q->count--;
+    bk_cond_signal(&q->not_full);
+    bk_mutex_unlock(&q->lock);
+    return 1;
+}
+
+static void queue_close(REQUEST_QUEUE *q)
+{
+    bk_mutex_lock(&q->lock);
+    q->closed = 1;
+    bk_cond_broadcast(&q->not_empty);
+    bk_mutex_unlock(&q->lock);
+}
+
+static void handle_request(BOOKING_SERVER *srv, BK_REQUEST *r)
+{
+    BOOKING_BACKEND *be = srv->pool.be;
+    BK_BOOKING rows[BK_MAX_LIST];
+    void *sess;
+    int slot, rc = BK_DB_ERROR, bid = 0, i;
+
+    slot = pool_checkout(&srv->pool);
+    sess = srv->pool.sess[slot];
+    switch (r->op) {
+        case OP_BOOK:   rc = be->book(sess, r->uid, r->sid, r->seat_id, &bid); break;
+        case OP_CHANGE: rc = be->change(sess, r->uid, r->bid, r->sid, r->seat_id); bid = r->bid; break;
+        case OP_CANCEL: rc = be->cancel(sess, r->uid, r->bid); bid = r->bid; break;
+        case OP_LIST:   rc = be->list(sess, r->uid, rows, BK_MAX_LIST); break;
+    }
+    pool_checkin(&srv->pool, slot);
+
+    bk_mutex_lock(&srv->out_lock);
+    if (r->op == OP_LIST && rc >= 0) {
+        printf("%d OK %d\n", r->seq, rc);
+        for (i = 0; i < rc; i++)
+            printf("%d   booking=%d schedule=%d seat=%d %s\n", r->seq, rows[i].booking_id, rows[i].schedule_id, rows[i].seat_id, rows[i].status);
+    } else if (rc == BK_OK) {
+        printf("%d OK booking=%d\n", r->seq, bid);
+    } else {
+        printf("%d %s\n", r->seq, bk_status_text(rc));
+    }
+    fflush(stdout);
+    bk_mutex_unlock(&srv->out_lock);
+}
+
+static void worker_main(void *arg)
+{
+    BOOKING_SERVER *srv = (BOOKING_SERVER *)arg;
+    BK_REQUEST r;
+    while (queue_pop(&srv->queue, &r)) handle_request(srv, &r);
+}
+
+/*   Ľ. û̸ 1, STATS 2,  ̸ 0 */
+static int parse_request(char *line, BK_REQUEST *r)
+{
+    char cmd[16];
+    memset(r, 0, sizeof(*r));
+    if (sscanf(line, "%15s", cmd) != 1) return 0;
+    if (strcmp(cmd, "BOOK") == 0 && sscanf(line, "%*s %d %d %d", &r->uid, &r->sid, &r->seat_id) == 3) { r->op = OP_BOOK; return 1; }
+    if (strcmp(cmd, "CHANGE") == 0 && sscanf(line, "%*s %d %d %d %d", &r->uid, &r->bid, &r->sid, &r->seat_id) == 4) { r->op = OP_CHANGE; return 1; }
+    if (strcmp(cmd, "CANCEL") == 0 && sscanf(line, "%*s %d %d", &r->uid, &r->bid) == 2) { r->op = OP_CANCEL; return 1; }
+    if (strcmp(cmd, "LIST") == 0 && sscanf(line, "%*s %d", &r->uid) == 1) { r->op = OP_LIST; return 1; }
+    if (strcmp(cmd, "STATS") == 0) return 2;
+    return 0;
+}
+
+int run_booking_server(BOOKING_BACKEND *be, int workers, int pool_size)
+{
+    static BOOKING_SERVER srv;
+    bk_thread_t th[MAX_WORKERS];
+    BK_REQUEST r;
+    char line[256];
+    int i, seq = 0, kind;
+
+    if (workers < 1) workers = 1;
+    if (workers > MAX_WORKERS) workers = MAX_WORKERS;
+
+    memset(&srv.queue, 0, sizeof(srv.queue));
+    bk_mutex_init(&srv.queue.lock);
+    bk_cond_init(&srv.queue.not_empty);
+    bk_cond_init(&srv.queue.not_full);
+    bk_mutex_init(&srv.out_lock);
+
+    if (pool_create(&srv.pool, be, pool_size) == 0) {
+        fprintf(stderr, "[SERVER] %s  ϳ  ߽ϴ.\n", be->name);
+        return -1;
+    }
+    for (i = 0; i < workers; i++) {
+        if (bk_thread_start(&th[i], worker_main, &srv) != 0) break;
+    }
+    workers = i;
+    fprintf(stderr, "[SERVER] backend=%s workers=%d pool=%d\n", be->name, workers, srv.pool.size);
+
+    while (fgets(line, sizeof(line), stdin) != NULL) {
+        kind = parse_request(line, &r);
+        if (kind == 1) { r.seq = ++seq; queue_push(&srv.queue, &r); }
+        else if (kind == 2) { bk_mutex_lock(&srv.out_lock); pool_print_stats(&srv.pool); bk_mutex_unlock(&srv.out_lock); }
+    }
+
+    queue_close(&srv.queue);
+    for (i = 0; i < workers; i++) bk_thread_join(th[i]);
+    pool_print_stats(&srv.pool);
+    pool_destroy(&srv.pool);
+    return seq;
+}
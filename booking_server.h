@@ -0,0 +1,73 @@
+#ifndef BOOKING_SERVER_H
+#define BOOKING_SERVER_H
+
+#include "booking_backend.h"
+
+/* /  (Windows: CRITICAL_SECTION,  : pthread) */
+#if defined(_WIN32) || defined(ORA_PROC)
+#include <windows.h>
+typedef CRITICAL_SECTION   bk_mutex_t;
+typedef CONDITION_VARIABLE bk_cond_t;
+typedef HANDLE             bk_thread_t;
+#else
+#include <pthread.h>
+typedef pthread_mutex_t    bk_mutex_t;
+typedef pthread_cond_t     bk_cond_t;
+typedef pthread_t          bk_thread_t;
+#endif
+
+void bk_mutex_init(bk_mutex_t *m);
+void bk_mutex_lock(bk_mutex_t *m);
+void bk_mutex_unlock(bk_mutex_t *m);
+void bk_cond_init(bk_cond_t *c);
+void bk_cond_wait(bk_cond_t *c, bk_mutex_t *m);
+void bk_cond_signal(bk_cond_t *c);
+void bk_cond_broadcast(bk_cond_t *c);
+int  bk_thread_start(bk_thread_t *t, void (*fn)(void *), void *arg);
+void bk_thread_join(bk_thread_t t);
+double bk_now_ms(void);
+
+/* () Ǯ: û üũƿ -> ó -> ݳ */
+#define POOL_MAX 64
+
+typedef struct {
+    BOOKING_BACKEND *be;
+    bk_mutex_t lock;
+    bk_cond_t  cond;
+    int    size;
+    void  *sess[POOL_MAX];
+    double born_ms[POOL_MAX];       /*   ð (  ) */
+    int    free_slot[POOL_MAX];     /*  ִ  ȣ  */
+    int    nfree;
+    long   checkouts;               /*  üũƿ */
+    long   waits;                   /*    ٸ Ƚ */
+    double wait_ms;                 /* ٸ ð  */
+} SESSION_POOL;
+
+int   pool_create(SESSION_POOL *p, BOOKING_BACKEND *be, int size);
+void  pool_destroy(SESSION_POOL *p);
+int   pool_checkout(SESSION_POOL *p);                /*  ȣ */
+void  pool_checkin(SESSION_POOL *p, int slot);
+void  pool_print_stats(SESSION_POOL *p);
+
+/*  : stdin   = û ϳ, Ŀ 尡  ó
+ *   BOOK <uid> <sid> <seat>
+ *   CHANGE <uid> <bid> <sid> <seat>
+ *   CANCEL <uid> <bid>
+ *   LIST <uid>
+ *   STATS
+ */
+#define OP_BOOK   1
+#define OP_CHANGE 2
+#define OP_CANCEL 3
+#define OP_LIST   4
+
+typedef struct {
+    int seq;
+    int op;
+    int uid, sid, seat_id, bid;
+} BK_REQUEST;
+
+int run_booking_server(BOOKING_BACKEND *be, int workers, int pool_size);
+
+#endif
@@ -0,0 +1,97 @@
+#ifndef CINEMA_DAO_H
+#define CINEMA_DAO_H
+
+#include "booking_backend.h"
+
+/*
+ * DAO : Users, Movies, Schedules, Seats, Bookings ټ ̺ 
+ *  - proc_dao     : Oracle (Pro*C,  = sql_context, proc_sample_all.pc)
+ *  - embedded_dao : μ   (ؽ ε,   , embedded_db.c)
+ *  -  ڵ BK_*  ״ .  Լ  ,   BK_DB_ERROR
+ *  -  README  
+ *      PK ߺ -> BK_DUP_KEY, FK -> BK_NO_USER / BK_NO_MOVIE / BK_NO_SCHEDULE / BK_BAD_SEAT
+ *      ó 010-0000-0000,  ð > 0,  >= 0,   3 -> BK_CHECK
+ *      (schedule_id, seat_id) UNIQUE -> BK_SEAT_TAKEN
+ */
+
+#define DAO_STATUS_PAID     "Ϸ"
+#define DAO_STATUS_CANCELED "ҵ"
+#define DAO_STATUS_HELD     ""
+
+typedef struct {
+    int  user_id;
+    char name[51];
+    char contact[21];           /*  ڿ = NULL */
+} DAO_USER;
+
+typedef struct {
+    int  movie_id;
+    char title[101];
+    char rating[21];            /* NOT NULL */
+    int  duration;              /* , > 0 */
+} DAO_MOVIE;
+
+typedef struct {
+    int  schedule_id;
+    int  movie_id;
+    int  screen_no;
+    char start_time[17];        /* YYYY-MM-DD HH24:MI */
+    int  price;                 /* >= 0 */
+} DAO_SCHEDULE;
+
+typedef struct {
+    int  seat_id;
+    int  screen_no;
+    char row_code[5];
+    int  col_code;
+} DAO_SEAT;
+
+typedef struct {
+    int  booking_id;            /* booking_insert äؼ  */
+    int  user_id;
+    int  schedule_id;
+    int  seat_id;
+    char status[20];
+    long created_at;            /* time_t  */
+} DAO_BOOKING;
+
+typedef struct {
+    const char *name;
+    void *(*open)(void);
+    void  (*close)(void *sess);
+
+    int (*user_insert)(void *sess, const DAO_USER *u);
+    int (*user_get)(void *sess, int user_id, DAO_USER *out);
+
+    int (*movie_insert)(void *sess, const DAO_MOVIE *m);
+    int (*movie_list)(void *sess, DAO_MOVIE *rows, int max);                        /* movie_id  */
+
+    int (*schedule_insert)(void *sess, const DAO_SCHEDULE *s);
+    int (*schedule_get)(void *sess, int schedule_id, DAO_SCHEDULE *out);
+    int (*schedule_list)(void *sess, int movie_id, DAO_SCHEDULE *rows, int max);    /* start_time  */
+
+    int (*seat_insert)(void *sess, const DAO_SEAT *s);
+    int (*seat_list)(void *sess, int screen_no, DAO_SEAT *rows, int max);           /* row_code, col_code  */
+
+    /* ¼   󿵰 ¼̾  (ƴϸ BK_BAD_SEAT)
+     * booking_move   ű  ٸ ǿ ٲ BK_CONFLICT */
+    int (*booking_insert)(void *sess, DAO_BOOKING *b);
+    int (*booking_move)(void *sess, int booking_id, int user_id, int new_sid, int new_seat_id);
+    int (*booking_set_status)(void *sess, int booking_id, const char *status);
+    int (*booking_delete)(void *sess, int booking_id, int user_id);
+    int (*booking_list)(void *sess, int user_id, DAO_BOOKING *rows, int max);       /* booking_id  */
+} CINEMA_DAO;
+
+/* embedded_db.c */
+extern CINEMA_DAO embedded_dao;
+int  embedded_db_open(const char *path);       /* path NULL̸ ޸𸮸 .  о   ̾  */
+int  embedded_db_checkpoint(void);             /*  ·  ٽ Ἥ α׸  */
+void embedded_db_close(void);
+
+/* proc_sample_all.pc */
+extern CINEMA_DAO proc_dao;
+
+/* dao_backend.c:  (BOOKING_BACKEND)    */
+void dao_backend_use(CINEMA_DAO *dao);
+
+#endif
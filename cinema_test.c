@@ -0,0 +1,415 @@
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cinema_dao.h"
+#include "seat_map.h"
+#include "id_set.h"
+#include "member_import.h"
+
+/*
+ * DB     ( ˻ ŭ ϰ  ڵ 1)
+ *  -    (PK, FK, ó,  ð,  ) α   / 
+ *  -  ¼ õ find_seat_block (Ʈ    ĭ   )
+ *  - ȸ ϰ  CSV   ؼ mi_parse_line, ó ˻ mi_contact_ok
+ *  -  ID  id_set
+ *
+ * / (, Oracle ʿ):
+ *   gcc -O2 -pthread cinema_test.c embedded_db.c booking_server.c seat_map.c member_import.c id_set.c -o cinema_test
+ *   ./cinema_test
+ * Visual Studio ַ cinema_test Ʈ ϸ   ̺Ʈ 
+ */
+
+static int checks, failures;
+
+#define CHECK(cond) do { checks++; if (!(cond)) { failures++; printf("[] %s:%d  %s\n", __FILE__, __LINE__, #cond); } } while (0)
+#define CHECK_EQ(a, b) do { long _a = (long)(a), _b = (long)(b); checks++; \
+    if (_a != _b) { failures++; printf("[] %s:%d  %s = %ld ( %ld)\n", __FILE__, __LINE__, #a, _a, _b); } } while (0)
+
+#define TEST_DB   "cinema_test.db"
+#define BLOCK_MAX 8                 /* ü  ִ ο (GROUP_MAX) */
+
+/*---------------   ----------------------*/
+static DAO_USER user(int id, const char *contact)
+{
+    DAO_USER u;
+    memset(&u, 0, sizeof(u));
+    u.user_id = id;
+    sprintf(u.name, "ȸ%d", id);
+    strcpy(u.contact, contact);
+    return u;
+}
+
+static DAO_BOOKING booking(int uid, int sid, int seat_id, const char *status)
+{
+    DAO_BOOKING b;
+    memset(&b, 0, sizeof(b));
+    b.user_id = uid;
+    b.schedule_id = sid;
+    b.seat_id = seat_id;
+    strcpy(b.status, status);
+    return b;
+}
+
+/* ȸ 2, ȭ 1, 󿵰 1(¼ 101~103) 2(¼ 201),  10(1) 20(2) */
+static void seed_tables(void *s)
+{
+    CINEMA_DAO *d = &embedded_dao;
+    DAO_MOVIE m = { 1, " ȭ", "12", 120 };
+    DAO_SCHEDULE s10 = { 10, 1, 1, "2026-01-01 10:00", 10000 }, s20 = { 20, 1, 2, "2026-01-01 13:00", 9000 };
+    DAO_SEAT t[4] = { { 101, 1, "A", 1 }, { 102, 1, "A", 2 }, { 103, 1, "A", 3 }, { 201, 2, "A", 1 } };
+    DAO_USER u;
+    int i;
+
+    u = user(1, "010-1234-5678"); CHECK_EQ(d->user_insert(s, &u), BK_OK);
+    u = user(2, "");              CHECK_EQ(d->user_insert(s, &u), BK_OK);     /* ó NULL */
+    CHECK_EQ(d->movie_insert(s, &m), BK_OK);
+    CHECK_EQ(d->schedule_insert(s, &s10), BK_OK);
+    CHECK_EQ(d->schedule_insert(s, &s20), BK_OK);
+    for (i = 0; i < 4; i++) CHECK_EQ(d->seat_insert(s, &t[i]), BK_OK);
+}
+
+static void test_constraints(void *s)
+{
+    CINEMA_DAO *d = &embedded_dao;
+    DAO_MOVIE m;
+    DAO_SCHEDULE sc;
+    DAO_SEAT t = { 101, 1, "A", 9 };
+    DAO_USER u;
+    DAO_BOOKING b;
+
+    /* PK */
+    u = user(1, "");                                    CHECK_EQ(d->user_insert(s, &u), BK_DUP_KEY);
+    CHECK_EQ(d->seat_insert(s, &t), BK_DUP_KEY);
+    m.movie_id = 1; strcpy(m.title, "ߺ"); strcpy(m.rating, "ü"); m.duration = 90;
+    CHECK_EQ(d->movie_insert(s, &m), BK_DUP_KEY);
+
+    /* ó 010-0000-0000 */
+    u = user(3, "010-1234-567");                        CHECK_EQ(d->user_insert(s, &u), BK_CHECK);
+    u = user(3, "011-1234-5678");                       CHECK_EQ(d->user_insert(s, &u), BK_CHECK);
+    u = user(3, "010-12a4-5678");                       CHECK_EQ(d->user_insert(s, &u), BK_CHECK);
+    u = user(3, "010.1234.5678");                       CHECK_EQ(d->user_insert(s, &u), BK_CHECK);
+
+    /*  ð > 0,   NOT NULL,  >= 0 */
+    m.movie_id = 2; m.duration = 0;                     CHECK_EQ(d->movie_insert(s, &m), BK_CHECK);
+    m.duration = -5;                                    CHECK_EQ(d->movie_insert(s, &m), BK_CHECK);
+    m.duration = 90; m.rating[0] = '\0';                CHECK_EQ(d->movie_insert(s, &m), BK_CHECK);
+    sc.schedule_id = 30; sc.movie_id = 1; sc.screen_no = 1; strcpy(sc.start_time, "2026-01-02 10:00"); sc.price = -1;
+    CHECK_EQ(d->schedule_insert(s, &sc), BK_CHECK);
+
+    /* FK */
+    sc.price = 0; sc.movie_id = 99;                     CHECK_EQ(d->schedule_insert(s, &sc), BK_NO_MOVIE);
+    b = booking(99, 10, 101, DAO_STATUS_PAID);          CHECK_EQ(d->booking_insert(s, &b), BK_NO_USER);
+    b = booking(1, 99, 101, DAO_STATUS_PAID);           CHECK_EQ(d->booking_insert(s, &b), BK_NO_SCHEDULE);
+    b = booking(1, 10, 999, DAO_STATUS_PAID);           CHECK_EQ(d->booking_insert(s, &b), BK_BAD_SEAT);
+    b = booking(1, 10, 201, DAO_STATUS_PAID);           CHECK_EQ(d->booking_insert(s, &b), BK_BAD_SEAT);   /* ٸ 󿵰 ¼ */
+
+    /*   3 */
+    b = booking(1, 10, 101, "ȯ");                    CHECK_EQ(d->booking_insert(s, &b), BK_CHECK);
+
+    /* (schedule_id, seat_id) UNIQUE, ̵,  ,  */
+    b = booking(1, 10, 101, DAO_STATUS_HELD);           CHECK_EQ(d->booking_insert(s, &b), BK_OK);
+    CHECK_EQ(b.booking_id, 1);
+    b = booking(2, 10, 101, DAO_STATUS_PAID);           CHECK_EQ(d->booking_insert(s, &b), BK_SEAT_TAKEN);
+    b = booking(2, 10, 102, DAO_STATUS_PAID);           CHECK_EQ(d->booking_insert(s, &b), BK_OK);
+    CHECK_EQ(b.booking_id, 2);
+    b = booking(2, 20, 201, DAO_STATUS_PAID);           CHECK_EQ(d->booking_insert(s, &b), BK_OK);
+    CHECK_EQ(b.booking_id, 3);
+
+    CHECK_EQ(d->booking_set_status(s, 1, DAO_STATUS_PAID), BK_OK);
+    CHECK_EQ(d->booking_set_status(s, 1, "ȯ"), BK_CHECK);
+    CHECK_EQ(d->booking_move(s, 1, 2, 10, 103), BK_NOT_OWNER);
+    CHECK_EQ(d->booking_move(s, 1, 1, 10, 102), BK_SEAT_TAKEN);
+    CHECK_EQ(d->booking_move(s, 1, 1, 20, 103), BK_BAD_SEAT);
+    CHECK_EQ(d->booking_move(s, 1, 1, 10, 103), BK_OK);
+    b = booking(2, 10, 101, DAO_STATUS_PAID);           CHECK_EQ(d->booking_insert(s, &b), BK_OK);  /*  ڸ */
+    CHECK_EQ(b.booking_id, 4);
+    CHECK_EQ(d->booking_delete(s, 4, 1), BK_NOT_OWNER);
+    CHECK_EQ(d->booking_delete(s, 4, 2), BK_OK);
+    CHECK_EQ(d->booking_delete(s, 4, 2), BK_NOT_OWNER);
+}
+
+/*  ڿ test_constraints  ¿  */
+static void check_state(void *s, const char *when)
+{
+    CINEMA_DAO *d = &embedded_dao;
+    DAO_BOOKING rows[8];
+    DAO_SEAT seats[8];
+    DAO_USER u;
+    int n, before = failures;
+
+    CHECK_EQ(d->user_get(s, 1, &u), BK_OK);
+    CHECK(strcmp(u.contact, "010-1234-5678") == 0);
+    CHECK_EQ(d->user_get(s, 2, &u), BK_OK);
+    CHECK(u.contact[0] == '\0');
+    CHECK_EQ(d->seat_list(s, 1, seats, 8), 3);
+
+    n = d->booking_list(s, 1, rows, 8);
+    CHECK_EQ(n, 1);
+    if (n == 1) {
+        CHECK_EQ(rows[0].booking_id, 1);
+        CHECK_EQ(rows[0].seat_id, 103);
+        CHECK(strcmp(rows[0].status, DAO_STATUS_PAID) == 0);
+    }
+    n = d->booking_list(s, 2, rows, 8);
+    CHECK_EQ(n, 2);
+    if (n == 2) {
+        CHECK_EQ(rows[0].booking_id, 3);                /* booking_id  */
+        CHECK_EQ(rows[1].booking_id, 2);
+    }
+    if (failures != before) printf("       (%s)\n", when);
+}
+
+static void test_embedded_db(void)
+{
+    CINEMA_DAO *d = &embedded_dao;
+    DAO_BOOKING b;
+    DAO_USER u;
+    FILE *fp;
+    void *s;
+
+    remove(TEST_DB);
+    CHECK_EQ(embedded_db_open(TEST_DB), 0);
+    s = d->open();
+    CHECK(s != NULL);
+    if (s == NULL) return;
+    seed_tables(s);
+    test_constraints(s);
+    check_state(s, "ó");
+    d->close(s);
+    embedded_db_close();
+
+    /* α ٽ . ٰ     */
+    fp = fopen(TEST_DB, "a");
+    CHECK(fp != NULL);
+    if (fp != NULL) { fputs("U\t77\t߸\t010-", fp); fclose(fp); }
+    CHECK_EQ(embedded_db_open(TEST_DB), 0);
+    s = d->open();
+    check_state(s, "α  ");
+    CHECK(d->user_get(s, 77, &u) != BK_OK);
+
+    /* ϸ   ȣ(4) ٽ  ʵ N  ƾ  */
+    CHECK_EQ(embedded_db_checkpoint(), 0);
+    d->close(s);
+    embedded_db_close();
+    CHECK_EQ(embedded_db_open(TEST_DB), 0);
+    s = d->open();
+    check_state(s, " ");
+    b = booking(1, 10, 101, DAO_STATUS_HELD);
+    CHECK_EQ(d->booking_insert(s, &b), BK_OK);
+    CHECK_EQ(b.booking_id, 5);
+    d->close(s);
+    embedded_db_close();
+    remove(TEST_DB);
+}
+
+/*--------------- ¼ ----------------------*/
+/* rows[r] =   ȣ (0 ). ȣ ̰   */
+static void make_map(SEAT_MAP *map, const int rows[][16], int nrows)
+{
+    int r, c;
+    memset(map, 0, sizeof(*map));
+    for (r = 0; r < nrows; r++) {
+        for (c = 0; rows[r][c] != 0; c++) {
+            SEAT_INFO *t = &map->seats[map->count];
+            t->seat_id = (r + 1) * 100 + rows[r][c];
+            sprintf(t->row, "%c", 'A' + r);
+            t->col = rows[r][c];
+            map->count++;
+        }
+    }
+    build_seat_layout(map);
+}
+
+static void take(SEAT_MAP *map, int idx)
+{
+    map->taken[idx >> 6] |= 1ULL << (idx & 63);
+}
+
+/* find_seat_block  Ģ  ĭ   */
+static int block_slow(SEAT_MAP *map, int n)
+{
+    int k, j, r, score, best = -1, best_score = 0, ideal = map->nrows * 2 / 3;
+
+    for (k = 0; k + n <= map->count; k++) {
+        for (j = 0; j < n; j++) {
+            if (seat_taken(map, k + j)) break;
+            if (j > 0 && (map->seats[k + j].row_no != map->seats[k].row_no || map->seats[k + j].col != map->seats[k + j - 1].col + 1)) break;
+        }
+        if (j < n) continue;
+        r = map->seats[k].row_no;
+        score = abs(map->seats[k].col + map->seats[k + n - 1].col - map->row_mid2[r]) * 2 + abs(r - ideal) * 3;
+        if (best < 0 || score < best_score) { best = k; best_score = score; }
+    }
+    return best;
+}
+
+static void test_seat_block(void)
+{
+    static SEAT_MAP map;
+    static const int hall[3][16] = {
+        { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 0 },
+        { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 0 },
+        { 1, 2, 3, 4, 5, 0 }
+    };
+    int rows[MAX_SEAT_ROWS][16];
+    int idx[BLOCK_MAX], i, r, c, n, iter, col;
+
+    make_map(&map, hall, 3);
+    CHECK_EQ(map.count, 25);
+    CHECK_EQ(map.nrows, 3);
+    CHECK_EQ(seat_remaining(&map), 25);
+
+    /*  󿵰: 3  1/3 (C)  2~4 */
+    CHECK_EQ(find_seat_block(&map, 3, idx), 21);
+    CHECK_EQ(idx[0], 21); CHECK_EQ(idx[2], 23);
+    /* 6 C(5)  Ƿ B 3~8 */
+    CHECK_EQ(find_seat_block(&map, 6, idx), 12);
+    CHECK_EQ(find_seat_block(&map, 11, idx), -1);
+    CHECK_EQ(find_seat_block(&map, 0, idx), -1);
+    CHECK_EQ(find_seat_block(&map, 26, idx), -1);
+
+    /*  Ѿ ̾ ڸ  ¼ ƴ: A10, B1  */
+    for (i = 0; i < map.count; i++) if (i != 9 && i != 10) take(&map, i);
+    CHECK_EQ(seat_remaining(&map), 2);
+    CHECK_EQ(find_seat_block(&map, 2, idx), -1);
+    CHECK(find_seat_block(&map, 1, idx) >= 0);
+
+    /* 64Ʈ  踦 Ѵ ڸ:   130  62~65 ڸ  */
+    memset(&map, 0, sizeof(map));
+    for (c = 0; c < 130; c++) {
+        map.seats[c].seat_id = c + 1;
+        strcpy(map.seats[c].row, "A");
+        map.seats[c].col = c + 1;
+    }
+    map.count = 130;
+    build_seat_layout(&map);
+    for (i = 0; i < 130; i++) if (i < 62 || i > 65) take(&map, i);
+    CHECK_EQ(popcount_words(map.taken, SEAT_WORDS), 126);
+    CHECK_EQ(find_seat_block(&map, 4, idx), 62);
+    CHECK_EQ(idx[3], 65);
+    CHECK_EQ(find_seat_block(&map, 5, idx), -1);
+
+    /* ο   󿵰  ĭ    */
+    srand(2024);
+    for (iter = 0; iter < 300; iter++) {
+        int nr = 1 + rand() % 12;
+        for (r = 0; r < nr; r++) {
+            int len = 1 + rand() % 15;
+            for (c = 0, col = 1; c < len; c++) {
+                if (rand() % 8 == 0) col++;                 /*  */
+                rows[r][c] = col++;
+            }
+            rows[r][len] = 0;
+        }
+        make_map(&map, (const int (*)[16])rows, nr);
+        for (i = 0; i < map.count; i++) if (rand() % 3 == 0) take(&map, i);
+        for (n = 1; n <= BLOCK_MAX; n++) {
+            int got = find_seat_block(&map, n, idx), want = block_slow(&map, n);
+            CHECK_EQ(got, want);
+            if (got != want) { printf("       (iter %d, n %d)\n", iter, n); break; }
+        }
+    }
+}
+
+/*--------------- ȸ CSV ----------------------*/
+static int parse(const char *text, MI_ROW *row)
+{
+    char line[MI_LINE_MAX + 2];
+    strcpy(line, text);
+    memset(row, 0x55, sizeof(*row));
+    return mi_parse_line(line, row);
+}
+
+static void test_member_import(void)
+{
+    MI_ROW row;
+    char name[MI_NAME_MAX + 2], line[MI_LINE_MAX];
+
+    CHECK(mi_contact_ok("010-1234-5678", 13));
+    CHECK(mi_contact_ok("", 0));
+    CHECK(mi_contact_ok("010-0000-9999", 13));
+    CHECK(!mi_contact_ok("010-1234-567", 12));
+    CHECK(!mi_contact_ok("010-1234-56789", 14));
+    CHECK(!mi_contact_ok("011-1234-5678", 13));
+    CHECK(!mi_contact_ok("010-1234 5678", 13));
+    CHECK(!mi_contact_ok("010-12:4-5678", 13));         /* '9'   */
+    CHECK(!mi_contact_ok("010-12/4-5678", 13));         /* '0'   */
+    CHECK(!mi_contact_ok("010-1234-567\xb0", 13));      /*  ASCII */
+    CHECK(!mi_contact_ok("\xb0\xa1""0-1234-5678", 13));
+
+    CHECK_EQ(parse("1001,ȫ浿,010-1234-5678\r\n", &row), MI_OK);
+    CHECK_EQ(row.user_id, 1001);
+    CHECK(strcmp(row.name, "ȫ浿") == 0);
+    CHECK(strcmp(row.contact, "010-1234-5678") == 0);
+
+    CHECK_EQ(parse(" 7 , \", \"\"ö\"\"\" ,", &row), MI_OK);   /* ǥ  ǥ "" */
+    CHECK_EQ(row.user_id, 7);
+    CHECK(strcmp(row.name, ", \"ö\"") == 0);
+    CHECK(row.contact[0] == '\0');
+
+    CHECK_EQ(parse("8,,", &row), MI_OK);
+    CHECK(row.name[0] == '\0' && row.contact[0] == '\0');
+
+    CHECK_EQ(parse("\n", &row), MI_SKIP);
+    CHECK_EQ(parse("", &row), MI_SKIP);
+    CHECK_EQ(parse("1,̸", &row), MI_BAD_FORMAT);
+    CHECK_EQ(parse("1,̸,010-1234-5678,x", &row), MI_BAD_FORMAT);
+    CHECK_EQ(parse("1,\"̸,010-1234-5678", &row), MI_BAD_FORMAT);
+    CHECK_EQ(parse("1,\"̸\"x,010-1234-5678", &row), MI_BAD_FORMAT);
+    CHECK_EQ(parse("abc,̸,", &row), MI_BAD_ID);
+    CHECK_EQ(parse("12x,̸,", &row), MI_BAD_ID);
+    CHECK_EQ(parse(",̸,", &row), MI_BAD_ID);
+    CHECK_EQ(parse("0,̸,", &row), MI_BAD_ID);
+    CHECK_EQ(parse("-5,̸,", &row), MI_BAD_ID);
+    CHECK_EQ(parse("2147483647,̸,", &row), MI_OK);
+    CHECK_EQ(parse("2147483648,̸,", &row), MI_BAD_ID);
+    CHECK_EQ(parse("1,̸,010-1234-567", &row), MI_BAD_CONTACT);
+
+    memset(name, 'a', MI_NAME_MAX);
+    name[MI_NAME_MAX] = '\0';
+    sprintf(line, "1,%s,", name);
+    CHECK_EQ(parse(line, &row), MI_OK);                 /* 50Ʈ */
+    strcat(name, "a");
+    sprintf(line, "1,%s,", name);
+    CHECK_EQ(parse(line, &row), MI_BAD_NAME);
+}
+
+/*--------------- ID  ----------------------*/
+static void test_id_set(void)
+{
+    ID_SET s;
+    int i, ok = 1;
+
+    CHECK_EQ(id_set_init(&s, 10), 0);
+    CHECK_EQ(id_set_add(&s, 42), 1);
+    CHECK_EQ(id_set_add(&s, 42), 0);
+    CHECK(id_set_has(&s, 42));
+    CHECK(!id_set_has(&s, 43));
+    CHECK(!id_set_has(&s, 0));
+    CHECK_EQ(id_set_add(&s, 0), 1);                     /*  ĭ ǥÿ   */
+    CHECK_EQ(id_set_add(&s, 0), 0);
+    CHECK(id_set_has(&s, 0));
+    CHECK_EQ(id_set_add(&s, -1), 1);
+    CHECK(id_set_has(&s, -1));
+
+    /*   þ   ִ (1024ĭ ) */
+    for (i = 1; i <= 20000; i++) if (id_set_add(&s, i * 7) != (i * 7 == 42 ? 0 : 1)) ok = 0;
+    CHECK(ok);
+    for (i = 1; i <= 20000; i++) if (!id_set_has(&s, i * 7) || id_set_has(&s, i * 7 + 1)) ok = 0;
+    CHECK(ok);
+    id_set_free(&s);
+}
+
+int main(void)
+{
+    test_embedded_db();
+    test_seat_block();
+    test_member_import();
+    test_id_set();
+
+    printf("%d ˻  %d \n", checks, failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,67 @@
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <string.h>
+
+#include "booking_backend.h"
+#include "cinema_dao.h"
+
+/*
+ * CINEMA_DAO   鿣 (BOOKING_BACKEND -> CINEMA_DAO ȯ)
+ *  -    ҵ  ȯ ϳ ħ. Ҵ dao_backend_use 
+ *      Oracle   : dao_backend_use(&proc_dao)
+ *        : local_backend_init dao_backend_use(&embedded_dao)
+ *  -   DAO  ״ 
+ */
+
+static CINEMA_DAO *Dao;
+
+void dao_backend_use(CINEMA_DAO *dao)
+{
+    Dao = dao;
+    dao_backend.name = dao->name;
+}
+
+static void *dao_open(void) { return Dao->open(); }
+static void dao_close(void *sess) { Dao->close(sess); }
+
+static int dao_book(void *sess, int uid, int sid, int seat_id, int *out_bid)
+{
+    DAO_BOOKING b;
+    int rc;
+
+    memset(&b, 0, sizeof(b));
+    b.user_id = uid; b.schedule_id = sid; b.seat_id = seat_id;
+    strcpy(b.status, DAO_STATUS_PAID);
+    if ((rc = Dao->booking_insert(sess, &b)) == BK_OK && out_bid) *out_bid = b.booking_id;
+    return rc;
+}
+
+static int dao_change(void *sess, int uid, int bid, int new_sid, int new_seat_id)
+{
+    return Dao->booking_move(sess, bid, uid, new_sid, new_seat_id);
+}
+
+static int dao_cancel(void *sess, int uid, int bid)
+{
+    return Dao->booking_delete(sess, bid, uid);
+}
+
+static int dao_list(void *sess, int uid, BK_BOOKING *rows, int max)
+{
+    DAO_BOOKING b[BK_MAX_LIST];
+    int i, n;
+
+    if (max > BK_MAX_LIST) max = BK_MAX_LIST;
+    if ((n = Dao->booking_list(sess, uid, b, max)) < 0) return n;
+    for (i = 0; i < n; i++) {
+        rows[i].booking_id = b[i].booking_id;
+        rows[i].schedule_id = b[i].schedule_id;
+        rows[i].seat_id = b[i].seat_id;
+        strcpy(rows[i].status, b[i].status);
+    }
+    return n;
+}
+
+BOOKING_BACKEND dao_backend = {
+    "dao", dao_open, dao_close, dao_book, dao_change, dao_cancel, dao_list
+};
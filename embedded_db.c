@@ -0,0 +1,672 @@
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <time.h>
+
+#include "booking_server.h"
+#include "cinema_dao.h"
+
+/*
+ *    (CINEMA_DAO , Oracle    Űũ/ġũ/CI)
+ *  - ̺ =  迭, PK  ã Ű ؽ ε ( Ž)
+ *      Users(user_id), Movies(movie_id), Schedules(schedule_id, movie_id ),
+ *      Seats(seat_id, screen_no ), Bookings(booking_id, (schedule_id, seat_id) UNIQUE, user_id )
+ *  -  ˻ README   (cinema_dao.h )
+ *  - ü  ϳ ȣ
+ *  -   (): 渶  پ α׿ ̰ fflush.   ó ٽ ؼ 
+ *      ߷  (ٰ ) . embedded_db_checkpoint  ¸  
+ *
+ * α  ( )
+ *   U id name contact / M id title rating duration / S id movie screen start price
+ *   T seat screen row col / B id user schedule seat status created
+ *   V id user schedule seat (¼ ) / X id status ( ) / D id user ()
+ *   N next_booking_id (  .   ȣ ٽ  ʰ)
+ */
+
+/*--------------- ؽ ε ----------------------*/
+#define SLOT_EMPTY -1
+#define SLOT_DEAD  -2
+
+typedef struct {
+    long long *keys;
+    int *vals;              /*  ȣ, SLOT_EMPTY / SLOT_DEAD */
+    int cap, used, dead;    /* cap 2 ŵ */
+} HASH_INDEX;
+
+static int hash_home(long long key, int cap)
+{
+    unsigned long long h = (unsigned long long)key * 0x9E3779B97F4A7C15ULL;
+    return (int)(h >> 40) & (cap - 1);
+}
+
+static int hash_init(HASH_INDEX *h, int cap)
+{
+    int i;
+    h->keys = (long long *)malloc(sizeof(long long) * cap);
+    h->vals = (int *)malloc(sizeof(int) * cap);
+    if (h->keys == NULL || h->vals == NULL) { free(h->keys); free(h->vals); return -1; }
+    for (i = 0; i < cap; i++) h->vals[i] = SLOT_EMPTY;
+    h->cap = cap; h->used = 0; h->dead = 0;
+    return 0;
+}
+
+static void hash_free(HASH_INDEX *h)
+{
+    free(h->keys); free(h->vals);
+    memset(h, 0, sizeof(*h));
+}
+
+static int hash_find(const HASH_INDEX *h, long long key)
+{
+    int i = hash_home(key, h->cap);
+    while (h->vals[i] != SLOT_EMPTY) {
+        if (h->vals[i] >= 0 && h->keys[i] == key) return h->vals[i];
+        i = (i + 1) & (h->cap - 1);
+    }
+    return -1;
+}
+
+/*   ٲ. ä 70%  ( ĭ ) ٽ ؽ */
+static int hash_put(HASH_INDEX *h, long long key, int val)
+{
+    int i, tomb = -1;
+
+    if ((h->used + h->dead + 1) * 10 > h->cap * 7) {
+        HASH_INDEX n;
+        int j, cap = (h->used + 1) * 10 > h->cap * 5 ? h->cap * 2 : h->cap;
+        if (hash_init(&n, cap) != 0) return -1;
+        for (j = 0; j < h->cap; j++) {
+            if (h->vals[j] < 0) continue;
+            i = hash_home(h->keys[j], n.cap);
+            while (n.vals[i] != SLOT_EMPTY) i = (i + 1) & (n.cap - 1);
+            n.keys[i] = h->keys[j]; n.vals[i] = h->vals[j]; n.used++;
+        }
+        hash_free(h);
+        *h = n;
+    }
+
+    i = hash_home(key, h->cap);
+    while (h->vals[i] != SLOT_EMPTY) {
+        if (h->vals[i] >= 0 && h->keys[i] == key) { h->vals[i] = val; return 0; }
+        if (h->vals[i] == SLOT_DEAD && tomb < 0) tomb = i;
+        i = (i + 1) & (h->cap - 1);
+    }
+    if (tomb >= 0) { i = tomb; h->dead--; }
+    h->keys[i] = key; h->vals[i] = val; h->used++;
+    return 0;
+}
+
+static void hash_del(HASH_INDEX *h, long long key)
+{
+    int i = hash_home(key, h->cap);
+    while (h->vals[i] != SLOT_EMPTY) {
+        if (h->vals[i] >= 0 && h->keys[i] == key) {
+            h->vals[i] = SLOT_DEAD; h->used--; h->dead++;
+            return;
+        }
+        i = (i + 1) & (h->cap - 1);
+    }
+}
+
+/*--------------- ̺ ----------------------*/
+typedef struct { DAO_SCHEDULE r; int next_by_movie; } SCHEDULE_ROW;
+typedef struct { DAO_SEAT r; int next_by_screen; } SEAT_ROW;
+typedef struct { DAO_BOOKING r; int alive; int prev_by_user, next_by_user; } BOOKING_ROW;
+
+static struct {
+    bk_mutex_t lock;
+    int opened;
+    FILE *log;                  /* NULL̸ ޸𸮸 */
+    char path[260];
+
+    DAO_USER *users;        int nusers, cap_users;       HASH_INDEX users_pk;
+    DAO_MOVIE *movies;      int nmovies, cap_movies;     HASH_INDEX movies_pk;
+    SCHEDULE_ROW *sch;      int nsch, cap_sch;           HASH_INDEX sch_pk, sch_by_movie;
+    SEAT_ROW *seats;        int nseats, cap_seats;       HASH_INDEX seats_pk, seats_by_screen;
+    BOOKING_ROW *bk;        int nbk, cap_bk;             HASH_INDEX bk_pk, bk_uk, bk_by_user;
+    int next_booking_id;
+} edb;
+
+#define UK_KEY(sid, seat) (((long long)(sid) << 32) | (unsigned int)(seat))
+
+/*  迭 n+1 ̻   ְ ø */
+static int grow(void **arr, int *cap, int n, size_t elem)
+{
+    void *p;
+    int c;
+    if (n < *cap) return 0;
+    c = *cap ? *cap * 2 : 64;
+    if ((p = realloc(*arr, elem * c)) == NULL) return -1;
+    *arr = p; *cap = c;
+    return 0;
+}
+
+/* α׿    (, ٹٲ)  */
+static void copy_field(char *dst, const char *src, size_t size)
+{
+    size_t i;
+    for (i = 0; src != NULL && src[i] != '\0' && i + 1 < size; i++)
+        dst[i] = (src[i] == '\t' || src[i] == '\n' || src[i] == '\r') ? ' ' : src[i];
+    dst[i] = '\0';
+}
+
+static void log_rec(int logged, const char *fmt, ...)
+{
+    va_list ap;
+    if (!logged || edb.log == NULL) return;
+    va_start(ap, fmt);
+    vfprintf(edb.log, fmt, ap);
+    va_end(ap);
+    fputc('\n', edb.log);
+    fflush(edb.log);
+}
+
+/* 010-0000-0000 ( ڿ NULL  ) */
+static int contact_ok(const char *c)
+{
+    int i;
+    if (c[0] == '\0') return 1;
+    if (strlen(c) != 13 || strncmp(c, "010-", 4) != 0 || c[8] != '-') return 0;
+    for (i = 4; i < 13; i++) {
+        if (i == 8) continue;
+        if (c[i] < '0' || c[i] > '9') return 0;
+    }
+    return 1;
+}
+
+static int status_ok(const char *s)
+{
+    return strcmp(s, DAO_STATUS_PAID) == 0 || strcmp(s, DAO_STATUS_CANCELED) == 0 || strcmp(s, DAO_STATUS_HELD) == 0;
+}
+
+/*---------------  (  ¿ ȣ, logged = 0̸  ) ----------------------*/
+static int do_user_insert(const DAO_USER *u, int logged)
+{
+    DAO_USER *r;
+    if (hash_find(&edb.users_pk, u->user_id) >= 0) return BK_DUP_KEY;
+    if (!contact_ok(u->contact)) return BK_CHECK;
+    if (grow((void **)&edb.users, &edb.cap_users, edb.nusers, sizeof(DAO_USER)) != 0) return BK_DB_ERROR;
+
+    r = &edb.users[edb.nusers];
+    r->user_id = u->user_id;
+    copy_field(r->name, u->name, sizeof(r->name));
+    copy_field(r->contact, u->contact, sizeof(r->contact));
+    if (hash_put(&edb.users_pk, r->user_id, edb.nusers) != 0) return BK_DB_ERROR;
+    edb.nusers++;
+    log_rec(logged, "U\t%d\t%s\t%s", r->user_id, r->name, r->contact);
+    return BK_OK;
+}
+
+static int do_movie_insert(const DAO_MOVIE *m, int logged)
+{
+    DAO_MOVIE *r;
+    if (hash_find(&edb.movies_pk, m->movie_id) >= 0) return BK_DUP_KEY;
+    if (m->rating[0] == '\0' || m->duration <= 0) return BK_CHECK;
+    if (grow((void **)&edb.movies, &edb.cap_movies, edb.nmovies, sizeof(DAO_MOVIE)) != 0) return BK_DB_ERROR;
+
+    r = &edb.movies[edb.nmovies];
+    r->movie_id = m->movie_id;
+    r->duration = m->duration;
+    copy_field(r->title, m->title, sizeof(r->title));
+    copy_field(r->rating, m->rating, sizeof(r->rating));
+    if (hash_put(&edb.movies_pk, r->movie_id, edb.nmovies) != 0) return BK_DB_ERROR;
+    edb.nmovies++;
+    log_rec(logged, "M\t%d\t%s\t%s\t%d", r->movie_id, r->title, r->rating, r->duration);
+    return BK_OK;
+}
+
+static int do_schedule_insert(const DAO_SCHEDULE *s, int logged)
+{
+    SCHEDULE_ROW *r;
+    if (hash_find(&edb.sch_pk, s->schedule_id) >= 0) return BK_DUP_KEY;
+    if (hash_find(&edb.movies_pk, s->movie_id) < 0) return BK_NO_MOVIE;
+    if (s->price < 0) return BK_CHECK;
+    if (grow((void **)&edb.sch, &edb.cap_sch, edb.nsch, sizeof(SCHEDULE_ROW)) != 0) return BK_DB_ERROR;
+
+    r = &edb.sch[edb.nsch];
+    r->r.schedule_id = s->schedule_id;
+    r->r.movie_id = s->movie_id;
+    r->r.screen_no = s->screen_no;
+    r->r.price = s->price;
+    copy_field(r->r.start_time, s->start_time, sizeof(r->r.start_time));
+    r->next_by_movie = hash_find(&edb.sch_by_movie, s->movie_id);
+    if (hash_put(&edb.sch_pk, s->schedule_id, edb.nsch) != 0 ||
+        hash_put(&edb.sch_by_movie, s->movie_id, edb.nsch) != 0) return BK_DB_ERROR;
+    edb.nsch++;
+    log_rec(logged, "S\t%d\t%d\t%d\t%s\t%d", r->r.schedule_id, r->r.movie_id, r->r.screen_no, r->r.start_time, r->r.price);
+    return BK_OK;
+}
+
+static int do_seat_insert(const DAO_SEAT *s, int logged)
+{
+    SEAT_ROW *r;
+    if (hash_find(&edb.seats_pk, s->seat_id) >= 0) return BK_DUP_KEY;
+    if (grow((void **)&edb.seats, &edb.cap_seats, edb.nseats, sizeof(SEAT_ROW)) != 0) return BK_DB_ERROR;
+
+    r = &edb.seats[edb.nseats];
+    r->r.seat_id = s->seat_id;
+    r->r.screen_no = s->screen_no;
+    r->r.col_code = s->col_code;
+    copy_field(r->r.row_code, s->row_code, sizeof(r->r.row_code));
+    r->next_by_screen = hash_find(&edb.seats_by_screen, s->screen_no);
+    if (hash_put(&edb.seats_pk, s->seat_id, edb.nseats) != 0 ||
+        hash_put(&edb.seats_by_screen, s->screen_no, edb.nseats) != 0) return BK_DB_ERROR;
+    edb.nseats++;
+    log_rec(logged, "T\t%d\t%d\t%s\t%d", r->r.seat_id, r->r.screen_no, r->r.row_code, r->r.col_code);
+    return BK_OK;
+}
+
+/* FK + ¼   󿵰 ¼ */
+static int check_seat_ref(int sid, int seat_id)
+{
+    int si = hash_find(&edb.sch_pk, sid), ti;
+    if (si < 0) return BK_NO_SCHEDULE;
+    if ((ti = hash_find(&edb.seats_pk, seat_id)) < 0) return BK_BAD_SEAT;
+    if (edb.seats[ti].r.screen_no != edb.sch[si].r.screen_no) return BK_BAD_SEAT;
+    return BK_OK;
+}
+
+static BOOKING_ROW *find_booking(int bid)
+{
+    int i = hash_find(&edb.bk_pk, bid);
+    return i < 0 ? NULL : &edb.bk[i];
+}
+
+/* b->booking_id 0̸ ä ( ߿ α ȣ ״) */
+static int do_booking_insert(DAO_BOOKING *b, int logged)
+{
+    BOOKING_ROW *r;
+    int rc, bid;
+
+    if (hash_find(&edb.users_pk, b->user_id) < 0) return BK_NO_USER;
+    if ((rc = check_seat_ref(b->schedule_id, b->seat_id)) != BK_OK) return rc;
+    if (!status_ok(b->status)) return BK_CHECK;
+    if (hash_find(&edb.bk_uk, UK_KEY(b->schedule_id, b->seat_id)) >= 0) return BK_SEAT_TAKEN;
+    bid = b->booking_id ? b->booking_id : edb.next_booking_id;
+    if (hash_find(&edb.bk_pk, bid) >= 0) return BK_DUP_KEY;
+    if (grow((void **)&edb.bk, &edb.cap_bk, edb.nbk, sizeof(BOOKING_ROW)) != 0) return BK_DB_ERROR;
+
+    r = &edb.bk[edb.nbk];
+    r->r = *b;
+    r->r.booking_id = bid;
+    if (r->r.created_at == 0) r->r.created_at = (long)time(NULL);
+    r->alive = 1;
+    r->prev_by_user = -1;
+    r->next_by_user = hash_find(&edb.bk_by_user, b->user_id);
+    if (r->next_by_user >= 0) edb.bk[r->next_by_user].prev_by_user = edb.nbk;
+    if (hash_put(&edb.bk_pk, bid, edb.nbk) != 0 ||
+        hash_put(&edb.bk_uk, UK_KEY(b->schedule_id, b->seat_id), edb.nbk) != 0 ||
+        hash_put(&edb.bk_by_user, b->user_id, edb.nbk) != 0) return BK_DB_ERROR;
+    edb.nbk++;
+    if (bid >= edb.next_booking_id) edb.next_booking_id = bid + 1;
+
+    b->booking_id = bid;
+    b->created_at = r->r.created_at;
+    log_rec(logged, "B\t%d\t%d\t%d\t%d\t%s\t%ld", bid, r->r.user_id, r->r.schedule_id, r->r.seat_id, r->r.status, r->r.created_at);
+    return BK_OK;
+}
+
+static int do_booking_move(int bid, int uid, int sid, int seat_id, int logged)
+{
+    BOOKING_ROW *r = find_booking(bid);
+    int rc, row;
+
+    if (r == NULL || r->r.user_id != uid) return BK_NOT_OWNER;
+    if ((rc = check_seat_ref(sid, seat_id)) != BK_OK) return rc;
+    if (r->r.schedule_id == sid && r->r.seat_id == seat_id) return BK_OK;
+    if (hash_find(&edb.bk_uk, UK_KEY(sid, seat_id)) >= 0) return BK_SEAT_TAKEN;
+
+    row = (int)(r - edb.bk);
+    hash_del(&edb.bk_uk, UK_KEY(r->r.schedule_id, r->r.seat_id));
+    if (hash_put(&edb.bk_uk, UK_KEY(sid, seat_id), row) != 0) return BK_DB_ERROR;
+    r->r.schedule_id = sid;
+    r->r.seat_id = seat_id;
+    log_rec(logged, "V\t%d\t%d\t%d\t%d", bid, uid, sid, seat_id);
+    return BK_OK;
+}
+
+static int do_booking_set_status(int bid, const char *status, int logged)
+{
+    BOOKING_ROW *r = find_booking(bid);
+    if (r == NULL) return BK_NOT_OWNER;
+    if (!status_ok(status)) return BK_CHECK;
+    copy_field(r->r.status, status, sizeof(r->r.status));
+    log_rec(logged, "X\t%d\t%s", bid, r->r.status);
+    return BK_OK;
+}
+
+static int do_booking_delete(int bid, int uid, int logged)
+{
+    BOOKING_ROW *r = find_booking(bid);
+
+    if (r == NULL || r->r.user_id != uid) return BK_NOT_OWNER;
+    hash_del(&edb.bk_pk, bid);
+    hash_del(&edb.bk_uk, UK_KEY(r->r.schedule_id, r->r.seat_id));
+    if (r->prev_by_user >= 0) edb.bk[r->prev_by_user].next_by_user = r->next_by_user;
+    else if (r->next_by_user >= 0) hash_put(&edb.bk_by_user, uid, r->next_by_user);
+    else hash_del(&edb.bk_by_user, uid);
+    if (r->next_by_user >= 0) edb.bk[r->next_by_user].prev_by_user = r->prev_by_user;
+    r->alive = 0;
+    log_rec(logged, "D\t%d\t%d", bid, uid);
+    return BK_OK;
+}
+
+/*---------------  /  /  ----------------------*/
+/*   ( ʵ ). ʵ  ȯ */
+static int split_fields(char *line, char **f, int max)
+{
+    int n = 0;
+    f[n++] = line;
+    for (; *line && n < max; line++) {
+        if (*line == '\t') { *line = '\0'; f[n++] = line + 1; }
+    }
+    return n;
+}
+
+static void replay_line(char *line, long lineno)
+{
+    char *f[8];
+    int n = split_fields(line, f, 8), rc = BK_CHECK;
+    DAO_USER u; DAO_MOVIE m; DAO_SCHEDULE s; DAO_SEAT t; DAO_BOOKING b;
+
+    memset(&b, 0, sizeof(b));
+    switch (f[0][0]) {
+        case 'U': if (n < 4) break;
+            u.user_id = atoi(f[1]); copy_field(u.name, f[2], sizeof(u.name)); copy_field(u.contact, f[3], sizeof(u.contact));
+            rc = do_user_insert(&u, 0); break;
+        case 'M': if (n < 5) break;
+            m.movie_id = atoi(f[1]); copy_field(m.title, f[2], sizeof(m.title)); copy_field(m.rating, f[3], sizeof(m.rating));
+            m.duration = atoi(f[4]);
+            rc = do_movie_insert(&m, 0); break;
+        case 'S': if (n < 6) break;
+            s.schedule_id = atoi(f[1]); s.movie_id = atoi(f[2]); s.screen_no = atoi(f[3]);
+            copy_field(s.start_time, f[4], sizeof(s.start_time)); s.price = atoi(f[5]);
+            rc = do_schedule_insert(&s, 0); break;
+        case 'T': if (n < 5) break;
+            t.seat_id = atoi(f[1]); t.screen_no = atoi(f[2]); copy_field(t.row_code, f[3], sizeof(t.row_code)); t.col_code = atoi(f[4]);
+            rc = do_seat_insert(&t, 0); break;
+        case 'B': if (n < 7) break;
+            b.booking_id = atoi(f[1]); b.user_id = atoi(f[2]); b.schedule_id = atoi(f[3]); b.seat_id = atoi(f[4]);
+            copy_field(b.status, f[5], sizeof(b.status)); b.created_at = atol(f[6]);
+            rc = do_booking_insert(&b, 0); break;
+        case 'V': if (n < 5) break;
+            rc = do_booking_move(atoi(f[1]), atoi(f[2]), atoi(f[3]), atoi(f[4]), 0); break;
+        case 'X': if (n < 3) break;
+            rc = do_booking_set_status(atoi(f[1]), f[2], 0); break;
+        case 'D': if (n < 3) break;
+            rc = do_booking_delete(atoi(f[1]), atoi(f[2]), 0); break;
+        case 'N': if (n < 2) break;
+            if (atoi(f[1]) > edb.next_booking_id) edb.next_booking_id = atoi(f[1]);
+            rc = BK_OK; break;
+    }
+    if (rc != BK_OK) fprintf(stderr, "[EMBEDDED] %s:%ld   (%s)\n", edb.path, lineno, bk_status_text(rc));
+}
+
+static void reset_tables(void)
+{
+    free(edb.users); free(edb.movies); free(edb.sch); free(edb.seats); free(edb.bk);
+    hash_free(&edb.users_pk); hash_free(&edb.movies_pk);
+    hash_free(&edb.sch_pk); hash_free(&edb.sch_by_movie);
+    hash_free(&edb.seats_pk); hash_free(&edb.seats_by_screen);
+    hash_free(&edb.bk_pk); hash_free(&edb.bk_uk); hash_free(&edb.bk_by_user);
+    edb.users = NULL; edb.movies = NULL; edb.sch = NULL; edb.seats = NULL; edb.bk = NULL;
+    edb.nusers = edb.nmovies = edb.nsch = edb.nseats = edb.nbk = 0;
+    edb.cap_users = edb.cap_movies = edb.cap_sch = edb.cap_seats = edb.cap_bk = 0;
+}
+
+int embedded_db_open(const char *path)
+{
+    FILE *fp;
+    char line[512];
+    long lineno = 0;
+    size_t len;
+
+    if (edb.opened) return 0;
+    if (hash_init(&edb.users_pk, 1024) || hash_init(&edb.movies_pk, 256) ||
+        hash_init(&edb.sch_pk, 1024) || hash_init(&edb.sch_by_movie, 256) ||
+        hash_init(&edb.seats_pk, 1024) || hash_init(&edb.seats_by_screen, 64) ||
+        hash_init(&edb.bk_pk, 4096) || hash_init(&edb.bk_uk, 4096) || hash_init(&edb.bk_by_user, 1024)) {
+        reset_tables();
+        return -1;
+    }
+    bk_mutex_init(&edb.lock);
+    edb.next_booking_id = 1;
+    edb.log = NULL;
+    edb.path[0] = '\0';
+
+    if (path != NULL && path[0] != '\0') {
+        copy_field(edb.path, path, sizeof(edb.path));
+        if ((fp = fopen(path, "r")) != NULL) {
+            while (fgets(line, sizeof(line), fp) != NULL) {
+                lineno++;
+                len = strlen(line);
+                if (len == 0 || line[len - 1] != '\n') {
+                    fprintf(stderr, "[EMBEDDED] %s:%ld ߸   \n", path, lineno);
+                    break;
+                }
+                line[len - 1] = '\0';
+                if (len > 1 && line[len - 2] == '\r') line[len - 2] = '\0';
+                replay_line(line, lineno);
+            }
+            fclose(fp);
+        }
+        if ((edb.log = fopen(path, "a")) == NULL) { reset_tables(); return -1; }
+    }
+    edb.opened = 1;
+    return 0;
+}
+
+int embedded_db_checkpoint(void)
+{
+    char tmp[270];
+    FILE *fp;
+    int i;
+
+    if (!edb.opened || edb.log == NULL) return 0;
+    bk_mutex_lock(&edb.lock);
+    sprintf(tmp, "%s.tmp", edb.path);
+    if ((fp = fopen(tmp, "w")) == NULL) { bk_mutex_unlock(&edb.lock); return -1; }
+
+    fprintf(fp, "N\t%d\n", edb.next_booking_id);
+
+    for (i = 0; i < edb.nusers; i++)
+        fprintf(fp, "U\t%d\t%s\t%s\n", edb.users[i].user_id, edb.users[i].name, edb.users[i].contact);
+    for (i = 0; i < edb.nmovies; i++)
+        fprintf(fp, "M\t%d\t%s\t%s\t%d\n", edb.movies[i].movie_id, edb.movies[i].title, edb.movies[i].rating, edb.movies[i].duration);
+    for (i = 0; i < edb.nsch; i++)
+        fprintf(fp, "S\t%d\t%d\t%d\t%s\t%d\n", edb.sch[i].r.schedule_id, edb.sch[i].r.movie_id, edb.sch[i].r.screen_no,
+                edb.sch[i].r.start_time, edb.sch[i].r.price);
+    for (i = 0; i < edb.nseats; i++)
+        fprintf(fp, "T\t%d\t%d\t%s\t%d\n", edb.seats[i].r.seat_id, edb.seats[i].r.screen_no, edb.seats[i].r.row_code, edb.seats[i].r.col_code);
+    for (i = 0; i < edb.nbk; i++) {
+        if (!edb.bk[i].alive) continue;
+        fprintf(fp, "B\t%d\t%d\t%d\t%d\t%s\t%ld\n", edb.bk[i].r.booking_id, edb.bk[i].r.user_id, edb.bk[i].r.schedule_id,
+                edb.bk[i].r.seat_id, edb.bk[i].r.status, edb.bk[i].r.created_at);
+    }
+
+    if (fclose(fp) != 0) { remove(tmp); bk_mutex_unlock(&edb.lock); return -1; }
+    fclose(edb.log);
+#ifdef _WIN32
+    remove(edb.path);
+#endif
+    if (rename(tmp, edb.path) != 0) {
+        edb.log = fopen(edb.path, "a");
+        bk_mutex_unlock(&edb.lock);
+        return -1;
+    }
+    edb.log = fopen(edb.path, "a");
+    bk_mutex_unlock(&edb.lock);
+    return edb.log != NULL ? 0 : -1;
+}
+
+void embedded_db_close(void)
+{
+    if (!edb.opened) return;
+    if (edb.log != NULL) fclose(edb.log);
+    edb.log = NULL;
+    reset_tables();
+    edb.opened = 0;
+}
+
+/*--------------- DAO Լ ----------------------*/
+static void *emb_open(void) { return edb.opened ? &edb : NULL; }
+static void emb_close(void *sess) { (void)sess; }
+
+#define LOCKED(expr) do { bk_mutex_lock(&edb.lock); rc = (expr); bk_mutex_unlock(&edb.lock); } while (0)
+
+static int emb_user_insert(void *sess, const DAO_USER *u)    { int rc; (void)sess; LOCKED(do_user_insert(u, 1)); return rc; }
+static int emb_movie_insert(void *sess, const DAO_MOVIE *m)  { int rc; (void)sess; LOCKED(do_movie_insert(m, 1)); return rc; }
+static int emb_schedule_insert(void *sess, const DAO_SCHEDULE *s) { int rc; (void)sess; LOCKED(do_schedule_insert(s, 1)); return rc; }
+static int emb_seat_insert(void *sess, const DAO_SEAT *s)    { int rc; (void)sess; LOCKED(do_seat_insert(s, 1)); return rc; }
+static int emb_booking_insert(void *sess, DAO_BOOKING *b)    { int rc; (void)sess; b->booking_id = 0; LOCKED(do_booking_insert(b, 1)); return rc; }
+
+static int emb_booking_move(void *sess, int bid, int uid, int sid, int seat_id)
+{
+    int rc; (void)sess;
+    LOCKED(do_booking_move(bid, uid, sid, seat_id, 1));
+    return rc;
+}
+
+static int emb_booking_set_status(void *sess, int bid, const char *status)
+{
+    int rc; (void)sess;
+    LOCKED(do_booking_set_status(bid, status, 1));
+    return rc;
+}
+
+static int emb_booking_delete(void *sess, int bid, int uid)
+{
+    int rc; (void)sess;
+    LOCKED(do_booking_delete(bid, uid, 1));
+    return rc;
+}
+
+static int emb_user_get(void *sess, int user_id, DAO_USER *out)
+{
+    int i;
+    (void)sess;
+    bk_mutex_lock(&edb.lock);
+    if ((i = hash_find(&edb.users_pk, user_id)) >= 0) *out = edb.users[i];
+    bk_mutex_unlock(&edb.lock);
+    return i >= 0 ? BK_OK : BK_NO_USER;
+}
+
+static int emb_schedule_get(void *sess, int schedule_id, DAO_SCHEDULE *out)
+{
+    int i;
+    (void)sess;
+    bk_mutex_lock(&edb.lock);
+    if ((i = hash_find(&edb.sch_pk, schedule_id)) >= 0) *out = edb.sch[i].r;
+    bk_mutex_unlock(&edb.lock);
+    return i >= 0 ? BK_OK : BK_NO_SCHEDULE;
+}
+
+static int cmp_movie(const void *a, const void *b)
+{
+    return ((const DAO_MOVIE *)a)->movie_id - ((const DAO_MOVIE *)b)->movie_id;
+}
+
+static int cmp_schedule(const void *a, const void *b)
+{
+    const DAO_SCHEDULE *x = (const DAO_SCHEDULE *)a, *y = (const DAO_SCHEDULE *)b;
+    int c = strcmp(x->start_time, y->start_time);
+    return c ? c : x->schedule_id - y->schedule_id;
+}
+
+static int cmp_seat(const void *a, const void *b)
+{
+    const DAO_SEAT *x = (const DAO_SEAT *)a, *y = (const DAO_SEAT *)b;
+    int c = strcmp(x->row_code, y->row_code);
+    return c ? c : x->col_code - y->col_code;
+}
+
+/*   տ max ַ  Ƽ ؾ  */
+static int emb_movie_list(void *sess, DAO_MOVIE *rows, int max)
+{
+    DAO_MOVIE *all;
+    int n;
+    (void)sess;
+
+    bk_mutex_lock(&edb.lock);
+    n = edb.nmovies;
+    if ((all = (DAO_MOVIE *)malloc(sizeof(DAO_MOVIE) * (n ? n : 1))) == NULL) { bk_mutex_unlock(&edb.lock); return BK_DB_ERROR; }
+    memcpy(all, edb.movies, sizeof(DAO_MOVIE) * n);
+    bk_mutex_unlock(&edb.lock);
+
+    qsort(all, n, sizeof(DAO_MOVIE), cmp_movie);
+    if (n > max) n = max;
+    memcpy(rows, all, sizeof(DAO_MOVIE) * n);
+    free(all);
+    return n;
+}
+
+/* movie_id 0̸ ü */
+static int emb_schedule_list(void *sess, int movie_id, DAO_SCHEDULE *rows, int max)
+{
+    DAO_SCHEDULE *all;
+    int n = 0, i;
+    (void)sess;
+
+    bk_mutex_lock(&edb.lock);
+    if ((all = (DAO_SCHEDULE *)malloc(sizeof(DAO_SCHEDULE) * (edb.nsch ? edb.nsch : 1))) == NULL) {
+        bk_mutex_unlock(&edb.lock);
+        return BK_DB_ERROR;
+    }
+    if (movie_id == 0) {
+        for (i = 0; i < edb.nsch; i++) all[n++] = edb.sch[i].r;
+    } else {
+        for (i = hash_find(&edb.sch_by_movie, movie_id); i >= 0; i = edb.sch[i].next_by_movie) all[n++] = edb.sch[i].r;
+    }
+    bk_mutex_unlock(&edb.lock);
+
+    qsort(all, n, sizeof(DAO_SCHEDULE), cmp_schedule);
+    if (n > max) n = max;
+    memcpy(rows, all, sizeof(DAO_SCHEDULE) * n);
+    free(all);
+    return n;
+}
+
+static int emb_seat_list(void *sess, int screen_no, DAO_SEAT *rows, int max)
+{
+    DAO_SEAT *all;
+    int n = 0, i;
+    (void)sess;
+
+    bk_mutex_lock(&edb.lock);
+    if ((all = (DAO_SEAT *)malloc(sizeof(DAO_SEAT) * (edb.nseats ? edb.nseats : 1))) == NULL) {
+        bk_mutex_unlock(&edb.lock);
+        return BK_DB_ERROR;
+    }
+    for (i = hash_find(&edb.seats_by_screen, screen_no); i >= 0; i = edb.seats[i].next_by_screen) all[n++] = edb.seats[i].r;
+    bk_mutex_unlock(&edb.lock);
+
+    qsort(all, n, sizeof(DAO_SEAT), cmp_seat);
+    if (n > max) n = max;
+    memcpy(rows, all, sizeof(DAO_SEAT) * n);
+    free(all);
+    return n;
+}
+
+/* ȸ      (= booking_id ) */
+static int emb_booking_list(void *sess, int user_id, DAO_BOOKING *rows, int max)
+{
+    int n = 0, i;
+    (void)sess;
+
+    bk_mutex_lock(&edb.lock);
+    for (i = hash_find(&edb.bk_by_user, user_id); i >= 0 && n < max; i = edb.bk[i].next_by_user) rows[n++] = edb.bk[i].r;
+    bk_mutex_unlock(&edb.lock);
+    return n;
+}
+
+CINEMA_DAO embedded_dao = {
+    "embedded", emb_open, emb_close,
+    emb_user_insert, emb_user_get,
+    emb_movie_insert, emb_movie_list,
+    emb_schedule_insert, emb_schedule_get, emb_schedule_list,
+    emb_seat_insert, emb_seat_list,
+    emb_booking_insert, emb_booking_move, emb_booking_set_status, emb_booking_delete, emb_booking_list
+};
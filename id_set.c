@@ -0,0 +1,71 @@
+#include <stdlib.h>
+
+#include "id_set.h"
+
+static unsigned int slot_of(unsigned int key, int cap)
+{
+    return (key * 2654435761u) & (unsigned int)(cap - 1);
+}
+
+int id_set_init(ID_SET *s, int expect)
+{
+    int cap = 1024;
+    while (cap < expect * 2) cap *= 2;
+    s->slot = (unsigned int *)calloc((size_t)cap, sizeof(unsigned int));
+    s->cap = s->slot ? cap : 0;
+    s->n = 0;
+    s->has_zero = 0;
+    return s->slot ? 0 : -1;
+}
+
+static int grow(ID_SET *s)
+{
+    int cap = s->cap * 2, i;
+    unsigned int *slot = (unsigned int *)calloc((size_t)cap, sizeof(unsigned int)), h;
+
+    if (slot == NULL) return -1;
+    for (i = 0; i < s->cap; i++) {
+        if (s->slot[i] == 0) continue;
+        for (h = slot_of(s->slot[i], cap); slot[h] != 0; h = (h + 1) & (unsigned int)(cap - 1));
+        slot[h] = s->slot[i];
+    }
+    free(s->slot);
+    s->slot = slot;
+    s->cap = cap;
+    return 0;
+}
+
+int id_set_add(ID_SET *s, int id)
+{
+    unsigned int key = (unsigned int)id, h;
+
+    if (key == 0) {
+        if (s->has_zero) return 0;
+        s->has_zero = 1;
+        return 1;
+    }
+    if ((s->n + 1) * 2 > s->cap && grow(s) < 0) return -1;
+    for (h = slot_of(key, s->cap); s->slot[h] != 0; h = (h + 1) & (unsigned int)(s->cap - 1))
+        if (s->slot[h] == key) return 0;
+    s->slot[h] = key;
+    s->n++;
+    return 1;
+}
+
+int id_set_has(const ID_SET *s, int id)
+{
+    unsigned int key = (unsigned int)id, h;
+
+    if (key == 0) return s->has_zero;
+    if (s->cap == 0) return 0;
+    for (h = slot_of(key, s->cap); s->slot[h] != 0; h = (h + 1) & (unsigned int)(s->cap - 1))
+        if (s->slot[h] == key) return 1;
+    return 0;
+}
+
+void id_set_free(ID_SET *s)
+{
+    free(s->slot);
+    s->slot = NULL;
+    s->cap = s->n = s->has_zero = 0;
+}
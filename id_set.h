@@ -0,0 +1,21 @@
+#ifndef ID_SET_H
+#define ID_SET_H
+
+/*
+ *  ID  ( ּҹ ؽ,  Ž)
+ *  - ĭ  2 ŵ.  Ѱ    ø.  
+ *  - 0  ĭ ǥ÷ Ƿ ID 0  
+ */
+
+typedef struct {
+    unsigned int *slot;
+    int cap, n;
+    int has_zero;
+} ID_SET;
+
+int  id_set_init(ID_SET *s, int expect);       /* ޸ ̸ -1 */
+int  id_set_add(ID_SET *s, int id);            /*  ־ 1, ̹  0, ޸ ̸ -1 */
+int  id_set_has(const ID_SET *s, int id);
+void id_set_free(ID_SET *s);
+
+#endif
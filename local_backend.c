@@ -0,0 +1,72 @@
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "booking_server.h"
+#include "cinema_dao.h"
+
+/*
+ * μ   鿣 (Oracle ü, ׽Ʈ/ġũ)
+ *  -   (embedded_dao) .      ϰ,  û dao_backend ȯ
+ *  - ȸ ID 1..users,  ID 1..schedules
+ *  -  sid 󿵰 = (sid - 1) % screens + 1
+ *  - 󿵰 k ¼ ID = (k - 1) * seats_per_screen + 1 .. k * seats_per_screen
+ *  - ȯ溯 CINEMA_DB  θ ָ  Ͽ ϰ,    ̾ 
+ *
+ *   : gcc -O2 -pthread local_server.c booking_server.c dao_backend.c local_backend.c embedded_db.c -o local_server
+ */
+
+#define LOCAL_MOVIES    10
+#define SEATS_PER_ROW   20
+
+/*  . Ͽ   PK ߺ̶ ǳʶ */
+static int seed(void *s, int users, int schedules, int screens, int seats_per_screen)
+{
+    DAO_USER u; DAO_MOVIE m; DAO_SCHEDULE sch; DAO_SEAT t;
+    int i, k, rc;
+
+#define SEED(call) do { rc = (call); if (rc != BK_OK && rc != BK_DUP_KEY) return -1; } while (0)
+    for (i = 1; i <= users; i++) {
+        u.user_id = i;
+        sprintf(u.name, "ȸ%d", i);
+        sprintf(u.contact, "010-%04d-%04d", i / 10000 % 10000, i % 10000);
+        SEED(embedded_dao.user_insert(s, &u));
+    }
+    for (i = 1; i <= LOCAL_MOVIES; i++) {
+        m.movie_id = i;
+        sprintf(m.title, "ȭ %d", i);
+        strcpy(m.rating, "ü");
+        m.duration = 90 + i * 5;
+        SEED(embedded_dao.movie_insert(s, &m));
+    }
+    for (k = 1; k <= screens; k++) {
+        for (i = 0; i < seats_per_screen; i++) {
+            t.seat_id = (k - 1) * seats_per_screen + 1 + i;
+            t.screen_no = k;
+            sprintf(t.row_code, "%c", 'A' + i / SEATS_PER_ROW);
+            t.col_code = i % SEATS_PER_ROW + 1;
+            SEED(embedded_dao.seat_insert(s, &t));
+        }
+    }
+    for (i = 1; i <= schedules; i++) {
+        sch.schedule_id = i;
+        sch.movie_id = (i - 1) % LOCAL_MOVIES + 1;
+        sch.screen_no = (i - 1) % screens + 1;
+        sprintf(sch.start_time, "2024-01-%02u %02u:00", (unsigned)(i - 1) / (screens * 8) % 28 + 1, (unsigned)(i - 1) / screens % 8 * 2 + 9);
+        sch.price = 12000;
+        SEED(embedded_dao.schedule_insert(s, &sch));
+    }
+#undef SEED
+    return 0;
+}
+
+int local_backend_init(int users, int schedules, int screens, int seats_per_screen)
+{
+    void *s;
+    if (embedded_db_open(getenv("CINEMA_DB")) != 0) return -1;
+    if ((s = embedded_dao.open()) == NULL) return -1;
+    dao_backend_use(&embedded_dao);
+    return seed(s, users, schedules, screens, seats_per_screen);
+}
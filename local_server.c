@@ -0,0 +1,25 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "booking_server.h"
+
+/*
+ * Oracle   带    (dao_backend +  )
+ *   gcc -O2 -pthread local_server.c booking_server.c dao_backend.c local_backend.c embedded_db.c -o local_server
+ *   ./local_server [workers] [pool] [users] [schedules] [screens] [seats] < requests.txt
+ */
+int main(int argc, char *argv[])
+{
+    int workers   = argc > 1 ? atoi(argv[1]) : 8;
+    int pool      = argc > 2 ? atoi(argv[2]) : 4;
+    int users     = argc > 3 ? atoi(argv[3]) : 1000;
+    int schedules = argc > 4 ? atoi(argv[4]) : 50;
+    int screens   = argc > 5 ? atoi(argv[5]) : 5;
+    int seats     = argc > 6 ? atoi(argv[6]) : 150;
+
+    if (local_backend_init(users, schedules, screens, seats) != 0) {
+        fprintf(stderr, "local backend ʱȭ \n");
+        return 1;
+    }
+    return run_booking_server(&dao_backend, workers, pool) < 0 ? 1 : 0;
+}
@@ -0,0 +1,120 @@
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "member_import.h"
+
+/*--------------- ó ˻ ----------------------*/
+/*  ^ Ʋ   ڸ  ִ(  0,  9)  8Ʈ   .
+ * Ʈ (x + 0x7f - ִ) ֻ Ʈ  ʰ. x ü ֻ Ʈ( ASCII)  */
+static const char contact_tmpl[13] = { '0','1','0','-','0','0','0','0','-','0','0','0','0' };
+static const unsigned char contact_add[13] = {
+    0x7f, 0x7f, 0x7f, 0x7f, 0x76, 0x76, 0x76, 0x76, 0x7f, 0x76, 0x76, 0x76, 0x76
+};
+
+static unsigned long long load8(const void *p)
+{
+    unsigned long long v;
+    memcpy(&v, p, 8);
+    return v;
+}
+
+static unsigned long long contact_bad8(const char *s, int off)
+{
+    unsigned long long x = load8(s + off) ^ load8(contact_tmpl + off);
+    return ((x + load8(contact_add + off)) | x) & 0x8080808080808080ULL;
+}
+
+int mi_contact_ok(const char *s, size_t len)
+{
+    if (len == 0) return 1;
+    if (len != 13) return 0;
+    /* 0..7, 5..12 ( ) */
+    return (contact_bad8(s, 0) | contact_bad8(s, 5)) == 0;
+}
+
+/*--------------- CSV   ----------------------*/
+static char *trim(char *s, size_t *len)
+{
+    while (*len > 0 && (s[*len - 1] == ' ' || s[*len - 1] == '\t')) s[--*len] = '\0';
+    while (*s == ' ' || *s == '\t') { s++; --*len; }
+    return s;
+}
+
+/* *p ʵ ϳ  . *p  ʵ (̾ NULL). ǥ   NULL ȯ */
+static char *next_field(char **p, size_t *len)
+{
+    char *s = *p, *r, *w, *comma;
+
+    while (*s == ' ' || *s == '\t') s++;
+    if (*s != '"') {
+        comma = strchr(s, ',');
+        if (comma != NULL) { *comma = '\0'; *p = comma + 1; }
+        else *p = NULL;
+        *len = strlen(s);
+        return trim(s, len);
+    }
+    for (w = r = ++s; ; ) {
+        if (*r == '\0') return NULL;
+        if (*r == '"') {
+            if (r[1] != '"') break;
+            r++;
+        }
+        *w++ = *r++;
+    }
+    for (r++; *r == ' ' || *r == '\t'; r++);
+    if (*r != ',' && *r != '\0') return NULL;
+    *p = (*r == ',') ? r + 1 : NULL;
+    *w = '\0';
+    *len = (size_t)(w - s);
+    return s;
+}
+
+int mi_parse_line(char *line, MI_ROW *out)
+{
+    char *f[3], *p = line, *end;
+    size_t len[3], n;
+    long id;
+    int i;
+
+    n = strcspn(line, "\r\n");
+    line[n] = '\0';
+    if (n == 0) return MI_SKIP;
+
+    for (i = 0; i < 3; i++) {
+        if (p == NULL || (f[i] = next_field(&p, &len[i])) == NULL) return MI_BAD_FORMAT;
+    }
+    if (p != NULL) return MI_BAD_FORMAT;
+
+    if (len[0] == 0 || len[0] > 10) return MI_BAD_ID;
+    id = strtol(f[0], &end, 10);
+    if (*end != '\0' || id <= 0 || id > 2147483647L) return MI_BAD_ID;
+    if (len[1] > MI_NAME_MAX) return MI_BAD_NAME;
+    if (!mi_contact_ok(f[2], len[2])) return MI_BAD_CONTACT;
+
+    out->user_id = (int)id;
+    memcpy(out->name, f[1], len[1] + 1);
+    memcpy(out->contact, f[2], len[2] + 1);
+    return MI_OK;
+}
+
+const char *mi_reason(int code)
+{
+    switch (code) {
+        case MI_BAD_FORMAT:  return " ";
+        case MI_BAD_ID:      return "ID ";
+        case MI_BAD_NAME:    return "̸ 50Ʈ ʰ";
+        case MI_BAD_CONTACT: return "ó  (010-0000-0000)";
+        case MI_DUP_ID:      return "ߺ ID";
+        case MI_TOO_LONG:    return " ʹ ";
+        default:             return "";
+    }
+}
+
+void mi_reject(FILE *fp, long line_no, const char *reason, const char *line)
+{
+    if (fp == NULL) return;
+    fprintf(fp, "%ld,%s,%.*s\n", line_no, reason, (int)strcspn(line, "\r\n"), line);
+}
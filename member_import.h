@@ -0,0 +1,40 @@
+#ifndef MEMBER_IMPORT_H
+#define MEMBER_IMPORT_H
+
+#include <stdio.h>
+#include <stddef.h>
+
+/*
+ * ȸ ϰ  (testpro import)  DB  κ
+ *  - CSV   "user_id,name,contact" -> MI_ROW. ǥ ʵ "" ̽ ,  ʵ NULL
+ *  - ó Users CHECK (REGEXP_LIKE 010-0000-0000)  Ģ 8Ʈ(SWAR) ˻
+ *  - ɷ   ź Ͽ " ȣ,, "  ( ٸ  ģ  ٽ   ְ)
+ */
+
+#define MI_NAME_MAX    50       /* Users.name VARCHAR2(50) */
+#define MI_CONTACT_MAX 20       /* Users.contact VARCHAR2(20) */
+#define MI_LINE_MAX    512
+
+enum {
+    MI_OK = 0,
+    MI_SKIP,                    /*   */
+    MI_BAD_FORMAT,              /* ʵ  3 ƴϰų ǥ   */
+    MI_BAD_ID,
+    MI_BAD_NAME,                /* 50Ʈ ʰ */
+    MI_BAD_CONTACT,
+    MI_DUP_ID,                  /* DB ְų  ʿ  ID */
+    MI_TOO_LONG                 /* MI_LINE_MAX Ѵ  */
+};
+
+typedef struct {
+    int  user_id;
+    char name[MI_NAME_MAX + 1];         /*  ڿ = NULL */
+    char contact[MI_CONTACT_MAX + 1];   /*  ڿ = NULL */
+} MI_ROW;
+
+int  mi_contact_ok(const char *s, size_t len);     /*  ڿ(NULL)  */
+int  mi_parse_line(char *line, MI_ROW *out);       /* line ߶ Ƿ   ʿϸ   */
+const char *mi_reason(int code);
+void mi_reject(FILE *fp, long line_no, const char *reason, const char *line);
+
+#endif
@@ -0,0 +1,68 @@
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <stdio.h>
+#include <string.h>
+
+/*
+ * scr_*.txt -> screen_data.c (ȭ ø  Ͽ ֱ  )
+ *   gcc -O2 mkscreens.c -o mkscreens
+ *   ./mkscreens scr_*.txt > screen_data.c
+ * ø ġ ٽ ؼ  Ŀ. Ʈ ״ ű (CP949)
+ */
+
+static const char *base_name(const char *path)
+{
+    const char *a = strrchr(path, '/'), *b = strrchr(path, '\\');
+    if (b > a) a = b;
+    return a ? a + 1 : path;
+}
+
+/* scr_main.txt -> scr_main */
+static void ident(char *dst, const char *name)
+{
+    for (; *name && *name != '.'; name++) *dst++ = (*name == '-') ? '_' : *name;
+    *dst = '\0';
+}
+
+int main(int argc, char *argv[])
+{
+    FILE *fp;
+    char id[64];
+    static int trailing[256];
+    int i, c, nlines, at_line_start, last;
+
+    if (argc - 1 > 256) { fprintf(stderr, "ø ʹ \n"); return 1; }
+
+    printf("/* mkscreens  .  ġ  scr_*.txt ģ  ٽ   */\n\n");
+    printf("#include \"screens.h\"\n");
+
+    for (i = 1; i < argc; i++) {
+        if ((fp = fopen(argv[i], "rb")) == NULL) { fprintf(stderr, "%s:   \n", argv[i]); return 1; }
+        ident(id, base_name(argv[i]));
+        printf("\nstatic const char *const %s_lines[] = {\n", id);
+        nlines = 0; at_line_start = 1; last = '\n';
+        while ((c = getc(fp)) != EOF) {
+            if (at_line_start) { printf("    \""); at_line_start = 0; }
+            last = c;
+            if (c == '\r') continue;
+            if (c == '\n') { printf("\",\n"); nlines++; at_line_start = 1; continue; }
+            if (c == '"' || c == '\\') putchar('\\');
+            putchar(c);
+        }
+        if (!at_line_start) { printf("\",\n"); nlines++; }
+        if (nlines == 0) printf("    \"\"\n");
+        printf("};\n");
+        fclose(fp);
+        trailing[i - 1] = (last == '\n');
+        fprintf(stderr, "%s: %d\n", argv[i], nlines);
+    }
+
+    printf("\nSCREEN_TEMPLATE screen_table[] = {\n");
+    for (i = 1; i < argc; i++) {
+        ident(id, base_name(argv[i]));
+        printf("    { \"%s\", (int)(sizeof(%s_lines) / sizeof(%s_lines[0])), %s_lines, %d },\n",
+               base_name(argv[i]), id, id, id, trailing[i - 1]);
+    }
+    printf("};\n\nconst int screen_count = %d;\n", argc - 1);
+    return 0;
+}
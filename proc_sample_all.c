@@ -1,2180 +0,0 @@
-
-/* Result Sets Interface */
-#ifndef SQL_CRSR
-#  define SQL_CRSR
-  struct sql_cursor
-  {
-    unsigned int curocn;
-    void *ptr1;
-    void *ptr2;
-    unsigned int magic;
-  };
-  typedef struct sql_cursor sql_cursor;
-  typedef struct sql_cursor SQL_CURSOR;
-#endif /* SQL_CRSR */
-
-/* Thread Safety */
-typedef void * sql_context;
-typedef void * SQL_CONTEXT;
-
-/* Object support */
-struct sqltvn
-{
-  unsigned char *tvnvsn; 
-  unsigned short tvnvsnl; 
-  unsigned char *tvnnm;
-  unsigned short tvnnml; 
-  unsigned char *tvnsnm;
-  unsigned short tvnsnml;
-};
-typedef struct sqltvn sqltvn;
-
-struct sqladts
-{
-  unsigned int adtvsn; 
-  unsigned short adtmode; 
-  unsigned short adtnum;  
-  sqltvn adttvn[1];       
-};
-typedef struct sqladts sqladts;
-
-static struct sqladts sqladt = {
-  1,1,0,
-};
-
-/* Binding to PL/SQL Records */
-struct sqltdss
-{
-  unsigned int tdsvsn; 
-  unsigned short tdsnum; 
-  unsigned char *tdsval[1]; 
-};
-typedef struct sqltdss sqltdss;
-static struct sqltdss sqltds =
-{
-  1,
-  0,
-};
-
-/* File name & Package Name */
-struct sqlcxp
-{
-  unsigned short fillen;
-           char  filnam[19];
-};
-static const struct sqlcxp sqlfpn =
-{
-    18,
-    "proc_sample_all.pc"
-};
-
-
-static unsigned int sqlctx = 20955931;
-
-
-static struct sqlexd {
-   unsigned int   sqlvsn;
-   unsigned int   arrsiz;
-   unsigned int   iters;
-   unsigned int   offset;
-   unsigned short selerr;
-   unsigned short sqlety;
-   unsigned int   occurs;
-      const short *cud;
-   unsigned char  *sqlest;
-      const char  *stmt;
-   sqladts *sqladtp;
-   sqltdss *sqltdsp;
-            void  **sqphsv;
-   unsigned int   *sqphsl;
-            int   *sqphss;
-            void  **sqpind;
-            int   *sqpins;
-   unsigned int   *sqparm;
-   unsigned int   **sqparc;
-   unsigned short  *sqpadto;
-   unsigned short  *sqptdso;
-   unsigned int   sqlcmax;
-   unsigned int   sqlcmin;
-   unsigned int   sqlcincr;
-   unsigned int   sqlctimeout;
-   unsigned int   sqlcnowait;
-              int   sqfoff;
-   unsigned int   sqcmod;
-   unsigned int   sqfmod;
-   unsigned int   sqlpfmem;
-            void  *sqhstv[5];
-   unsigned int   sqhstl[5];
-            int   sqhsts[5];
-            void  *sqindv[5];
-            int   sqinds[5];
-   unsigned int   sqharm[5];
-   unsigned int   *sqharc[5];
-   unsigned short  sqadto[5];
-   unsigned short  sqtdso[5];
-} sqlstm = {13,5};
-
-/* SQLLIB Prototypes */
-extern void sqlcxt (void **, unsigned int *,
-                    struct sqlexd *, const struct sqlcxp *);
-extern void sqlcx2t(void **, unsigned int *,
-                    struct sqlexd *, const struct sqlcxp *);
-extern void sqlbuft(void **, char *);
-extern void sqlgs2t(void **, char *);
-extern void sqlorat(void **, unsigned int *, void *);
-
-/* Forms Interface */
-static const int IAPSUCC = 0;
-static const int IAPFAIL = 1403;
-static const int IAPFTL  = 535;
-extern void sqliem(unsigned char *, signed int *);
-
- static const char *sq0003 = 
-"select b.booking_id ,m.title ,to_char(sch.start_time,'MM-DD HH24:MI') ,((s.r\
-ow_code||'-')||s.col_code) ,b.status  from Bookings b ,Schedules sch ,Movies m\
- ,Seats s where (((b.schedule_id=sch.schedule_id and sch.movie_id=m.movie_id) \
-and b.seat_id=s.seat_id) and b.user_id=:b0) order by b.booking_id desc        \
-     ";
-
- static const char *sq0008 = 
-"select movie_id ,title ,rating ,duration  from Movies  order by movie_id    \
-        ";
-
- static const char *sq0009 = 
-"select s.schedule_id ,m.title ,s.screen_no ,to_char(s.start_time,'YYYY-MM-DD\
- HH24:MI') ,s.price  from Schedules s ,Movies m where (s.movie_id=m.movie_id a\
-nd s.movie_id=:b0) order by s.start_time            ";
-
- static const char *sq0012 = 
-"select seat_id ,screen_no ,row_code ,col_code  from Seats where screen_no=:b\
-0 order by row_code,col_code            ";
-
-typedef struct { unsigned short len; unsigned char arr[1]; } VARCHAR;
-typedef struct { unsigned short len; unsigned char arr[1]; } varchar;
-
-/* cud (compilation unit data) array */
-static const short sqlcud0[] =
-{13,4130,1,0,0,
-5,0,0,1,0,0,30,94,0,0,0,0,0,1,0,
-20,0,0,0,0,0,27,110,0,0,4,4,0,1,0,1,9,0,0,1,9,0,0,1,10,0,0,1,10,0,0,
-51,0,0,3,315,0,9,154,0,0,1,1,0,1,0,1,3,0,0,
-70,0,0,3,0,0,13,157,0,0,5,0,0,1,0,2,3,0,0,2,97,0,0,2,97,0,0,2,97,0,0,2,97,0,0,
-105,0,0,3,0,0,15,179,0,0,0,0,0,1,0,
-120,0,0,4,55,0,4,213,0,0,2,1,0,1,0,2,3,0,0,1,3,0,0,
-143,0,0,5,61,0,3,230,0,0,3,3,0,1,0,1,3,0,0,1,97,0,0,1,97,0,0,
-170,0,0,6,0,0,29,233,0,0,0,0,0,1,0,
-185,0,0,7,0,0,31,237,0,0,0,0,0,1,0,
-200,0,0,8,84,0,9,261,0,0,0,0,0,1,0,
-215,0,0,8,0,0,13,264,0,0,4,0,0,1,0,2,3,0,0,2,97,0,0,2,97,0,0,2,3,0,0,
-246,0,0,8,0,0,15,270,0,0,0,0,0,1,0,
-261,0,0,9,206,0,9,289,0,0,1,1,0,1,0,1,3,0,0,
-280,0,0,9,0,0,13,292,0,0,5,0,0,1,0,2,3,0,0,2,97,0,0,2,3,0,0,2,97,0,0,2,3,0,0,
-315,0,0,9,0,0,15,297,0,0,0,0,0,1,0,
-330,0,0,10,82,0,4,308,0,0,3,2,0,1,0,2,3,0,0,1,3,0,0,1,3,0,0,
-357,0,0,11,63,0,4,311,0,0,2,1,0,1,0,2,3,0,0,1,3,0,0,
-380,0,0,12,116,0,9,318,0,0,1,1,0,1,0,1,3,0,0,
-399,0,0,12,0,0,13,321,0,0,4,0,0,1,0,2,3,0,0,2,3,0,0,2,97,0,0,2,3,0,0,
-430,0,0,13,80,0,4,323,0,0,3,2,0,1,0,2,3,0,0,1,3,0,0,1,3,0,0,
-457,0,0,12,0,0,15,328,0,0,0,0,0,1,0,
-472,0,0,14,75,0,4,338,0,0,3,2,0,1,0,2,3,0,0,1,3,0,0,1,3,0,0,
-499,0,0,15,80,0,4,341,0,0,3,2,0,1,0,2,3,0,0,1,3,0,0,1,3,0,0,
-526,0,0,16,55,0,4,362,0,0,2,1,0,1,0,2,3,0,0,1,3,0,0,
-549,0,0,17,89,0,3,367,0,0,3,3,0,1,0,1,3,0,0,1,3,0,0,1,3,0,0,
-576,0,0,18,0,0,29,370,0,0,0,0,0,1,0,
-591,0,0,19,0,0,31,373,0,0,0,0,0,1,0,
-606,0,0,20,55,0,4,393,0,0,2,1,0,1,0,2,3,0,0,1,3,0,0,
-629,0,0,21,0,0,29,413,0,0,0,0,0,1,0,
-644,0,0,22,79,0,4,433,0,0,3,2,0,1,0,2,3,0,0,1,3,0,0,1,3,0,0,
-671,0,0,23,69,0,5,448,0,0,3,3,0,1,0,1,3,0,0,1,3,0,0,1,3,0,0,
-698,0,0,24,0,0,29,451,0,0,0,0,0,1,0,
-713,0,0,25,0,0,31,454,0,0,0,0,0,1,0,
-728,0,0,26,0,0,29,469,0,0,0,0,0,1,0,
-743,0,0,27,79,0,4,487,0,0,3,2,0,1,0,2,3,0,0,1,3,0,0,1,3,0,0,
-770,0,0,28,43,0,2,499,0,0,1,1,0,1,0,1,3,0,0,
-789,0,0,29,0,0,29,501,0,0,0,0,0,1,0,
-};
-
-
-#define _CRT_SECURE_NO_WARNINGS
-
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include <conio.h>
-#include <ctype.h>
-#include <windows.h>
-
-/* Oracle Header */
-#include <sqlda.h>
-#include <sqlca.h>
-#include <sqlcpr.h>
-
-#define getch() _getch()
-
-/*--------------- ȭ  Լ ----------------------*/
-void gotoxy(int x, int y);
-void getxy(int *x, int *y);
-void clrscr(void);
-/*----------------------------------------------------*/
-
-/* UI & DB Լ */
-void print_screen(char fname[]);
-void db_connect();
-void sql_error();
-
-// Է ۸  Լ 
-void flush_input(void) {
-    int c;
-    // Է ۿ ִ ڰ ִٸ    (Enter Ű )
-    while ((c = getchar()) != '\n' && c != EOF);
-}
-
-//  ڿ  ٹٲ  
-void cleanup_input(char *str) {
-    if (str == NULL) return;
-    size_t len = strlen(str);
-    if (len > 0 && str[len - 1] == '\n') {
-        str[len - 1] = '\0';
-    }
-}
-
-/*  Լ */
-void fn_signup();       
-void fn_booking_flow(); 
-void fn_my_booking();   
-void fn_change_booking(); 
-void fn_cancel();       
-
-//  Լ
-int show_booking_list(int uid, int mode); 
-
-// ƿƼ
-int select_schedule_logic(int *sid, int *seatid, int *screen_no);
-
-int Error_flag = 0;
-
-void main()
-{
-    char c = 0;
-    char main_buf[10];
-
-    _putenv("NLS_LANG=American_America.KO16KSC5601");
-    /* EXEC SQL WHENEVER SQLERROR DO sql_error("\7SQL Error:"); */ 
-
-
-    db_connect();
-
-    while( c != '6') {  
-        clrscr();
-        print_screen("scr_main.txt");
-        
-        gotoxy(44, 18);
-        
-        if (fgets(main_buf, sizeof(main_buf), stdin) != NULL) {
-            c = main_buf[0];
-        } else {
-            c = ' ';
-        }
-
-        switch(c){
-            case '1' : fn_signup(); break;
-            case '2' : fn_booking_flow(); break;
-            case '3' : fn_my_booking(); break;
-            case '4' : fn_change_booking(); break; //  
-            case '5' : fn_cancel(); break;
-            case '6' : break;
-            default : break;
-        }      
-    }
-   
-    clrscr();
-    printf("\n ý մϴ.\n");
-    /* EXEC SQL COMMIT WORK RELEASE; */ 
-
-{
-    struct sqlexd sqlstm;
-    sqlstm.sqlvsn = 13;
-    sqlstm.arrsiz = 0;
-    sqlstm.sqladtp = &sqladt;
-    sqlstm.sqltdsp = &sqltds;
-    sqlstm.iters = (unsigned int  )1;
-    sqlstm.offset = (unsigned int  )5;
-    sqlstm.cud = sqlcud0;
-    sqlstm.sqlest = (unsigned char  *)&sqlca;
-    sqlstm.sqlety = (unsigned short)4352;
-    sqlstm.occurs = (unsigned int  )0;
-    sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-    if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-}
-
-void db_connect()
-{
-    /* EXEC SQL BEGIN DECLARE SECTION; */ 
-
-        /* VARCHAR uid[80]; */ 
-struct { unsigned short len; unsigned char arr[80]; } uid;
-
-        /* VARCHAR pwd[20]; */ 
-struct { unsigned short len; unsigned char arr[20]; } pwd;
-
-    /* EXEC SQL END DECLARE SECTION; */ 
-
-
-    strcpy((char *)uid.arr, "se20212979@//sedb.deu.ac.kr:1521/orcl");
-    uid.len = (short) strlen((char *)uid.arr);
-    strcpy((char *)pwd.arr, "20212979");
-    pwd.len = (short) strlen((char *)pwd.arr);
-
-    Error_flag = 0;   
-    /* EXEC SQL CONNECT :uid IDENTIFIED BY :pwd; */ 
-
-{
-    struct sqlexd sqlstm;
-    sqlstm.sqlvsn = 13;
-    sqlstm.arrsiz = 4;
-    sqlstm.sqladtp = &sqladt;
-    sqlstm.sqltdsp = &sqltds;
-    sqlstm.iters = (unsigned int  )10;
-    sqlstm.offset = (unsigned int  )20;
-    sqlstm.cud = sqlcud0;
-    sqlstm.sqlest = (unsigned char  *)&sqlca;
-    sqlstm.sqlety = (unsigned short)4352;
-    sqlstm.occurs = (unsigned int  )0;
-    sqlstm.sqhstv[0] = (         void  *)&uid;
-    sqlstm.sqhstl[0] = (unsigned int  )82;
-    sqlstm.sqhsts[0] = (         int  )82;
-    sqlstm.sqindv[0] = (         void  *)0;
-    sqlstm.sqinds[0] = (         int  )0;
-    sqlstm.sqharm[0] = (unsigned int  )0;
-    sqlstm.sqadto[0] = (unsigned short )0;
-    sqlstm.sqtdso[0] = (unsigned short )0;
-    sqlstm.sqhstv[1] = (         void  *)&pwd;
-    sqlstm.sqhstl[1] = (unsigned int  )22;
-    sqlstm.sqhsts[1] = (         int  )22;
-    sqlstm.sqindv[1] = (         void  *)0;
-    sqlstm.sqinds[1] = (         int  )0;
-    sqlstm.sqharm[1] = (unsigned int  )0;
-    sqlstm.sqadto[1] = (unsigned short )0;
-    sqlstm.sqtdso[1] = (unsigned short )0;
-    sqlstm.sqphsv = sqlstm.sqhstv;
-    sqlstm.sqphsl = sqlstm.sqhstl;
-    sqlstm.sqphss = sqlstm.sqhsts;
-    sqlstm.sqpind = sqlstm.sqindv;
-    sqlstm.sqpins = sqlstm.sqinds;
-    sqlstm.sqparm = sqlstm.sqharm;
-    sqlstm.sqparc = sqlstm.sqharc;
-    sqlstm.sqpadto = sqlstm.sqadto;
-    sqlstm.sqptdso = sqlstm.sqtdso;
-    sqlstm.sqlcmax = (unsigned int )100;
-    sqlstm.sqlcmin = (unsigned int )2;
-    sqlstm.sqlcincr = (unsigned int )1;
-    sqlstm.sqlctimeout = (unsigned int )0;
-    sqlstm.sqlcnowait = (unsigned int )0;
-    sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-    if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-
-    if (Error_flag == 1){
-        printf("DB  !\n");
-        getch();
-        exit(-1);
-    }
-}
-
-int show_booking_list(int uid, int mode)
-{
-    /* EXEC SQL BEGIN DECLARE SECTION; */ 
-
-        int v_bid;
-        char v_mtitle[100];
-        char v_stime[30];
-        char v_seat[20];
-        char v_status[20];
-        int search_uid;
-        int count = 0;
-    /* EXEC SQL END DECLARE SECTION; */ 
-
-
-    search_uid = uid;
-    int y;
-
-    if (mode == 0) {
-        y = 6; 
-    } else {
-        y = 18;
-        gotoxy(1, y++);
-        printf("---------------- [ ȸ   (ID: %d) ] ----------------", uid);
-        gotoxy(1, y++);
-        printf(" ID   ȭ                       ¼");
-    }
-    
-    /* EXEC SQL DECLARE c_list CURSOR FOR 
-        SELECT b.booking_id, m.title, to_char(sch.start_time, 'MM-DD HH24:MI'), 
-               s.row_code || '-' || s.col_code, b.status
-        FROM Bookings b, Schedules sch, Movies m, Seats s
-        WHERE b.schedule_id = sch.schedule_id
-          AND sch.movie_id = m.movie_id
-          AND b.seat_id = s.seat_id
-          AND b.user_id = :search_uid
-        ORDER BY b.booking_id DESC; */ 
-
-
-    /* EXEC SQL OPEN c_list; */ 
-
-{
-    struct sqlexd sqlstm;
-    sqlstm.sqlvsn = 13;
-    sqlstm.arrsiz = 4;
-    sqlstm.sqladtp = &sqladt;
-    sqlstm.sqltdsp = &sqltds;
-    sqlstm.stmt = sq0003;
-    sqlstm.iters = (unsigned int  )1;
-    sqlstm.offset = (unsigned int  )51;
-    sqlstm.selerr = (unsigned short)1;
-    sqlstm.sqlpfmem = (unsigned int  )0;
-    sqlstm.cud = sqlcud0;
-    sqlstm.sqlest = (unsigned char  *)&sqlca;
-    sqlstm.sqlety = (unsigned short)4352;
-    sqlstm.occurs = (unsigned int  )0;
-    sqlstm.sqcmod = (unsigned int )0;
-    sqlstm.sqhstv[0] = (         void  *)&search_uid;
-    sqlstm.sqhstl[0] = (unsigned int  )sizeof(int);
-    sqlstm.sqhsts[0] = (         int  )0;
-    sqlstm.sqindv[0] = (         void  *)0;
-    sqlstm.sqinds[0] = (         int  )0;
-    sqlstm.sqharm[0] = (unsigned int  )0;
-    sqlstm.sqadto[0] = (unsigned short )0;
-    sqlstm.sqtdso[0] = (unsigned short )0;
-    sqlstm.sqphsv = sqlstm.sqhstv;
-    sqlstm.sqphsl = sqlstm.sqhstl;
-    sqlstm.sqphss = sqlstm.sqhsts;
-    sqlstm.sqpind = sqlstm.sqindv;
-    sqlstm.sqpins = sqlstm.sqinds;
-    sqlstm.sqparm = sqlstm.sqharm;
-    sqlstm.sqparc = sqlstm.sqharc;
-    sqlstm.sqpadto = sqlstm.sqadto;
-    sqlstm.sqptdso = sqlstm.sqtdso;
-    sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-    if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-
-    while(1) {
-        /* EXEC SQL FETCH c_list INTO :v_bid, :v_mtitle, :v_stime, :v_seat, :v_status; */ 
-
-{
-        struct sqlexd sqlstm;
-        sqlstm.sqlvsn = 13;
-        sqlstm.arrsiz = 5;
-        sqlstm.sqladtp = &sqladt;
-        sqlstm.sqltdsp = &sqltds;
-        sqlstm.iters = (unsigned int  )1;
-        sqlstm.offset = (unsigned int  )70;
-        sqlstm.selerr = (unsigned short)1;
-        sqlstm.sqlpfmem = (unsigned int  )0;
-        sqlstm.cud = sqlcud0;
-        sqlstm.sqlest = (unsigned char  *)&sqlca;
-        sqlstm.sqlety = (unsigned short)4352;
-        sqlstm.occurs = (unsigned int  )0;
-        sqlstm.sqfoff = (           int )0;
-        sqlstm.sqfmod = (unsigned int )2;
-        sqlstm.sqhstv[0] = (         void  *)&v_bid;
-        sqlstm.sqhstl[0] = (unsigned int  )sizeof(int);
-        sqlstm.sqhsts[0] = (         int  )0;
-        sqlstm.sqindv[0] = (         void  *)0;
-        sqlstm.sqinds[0] = (         int  )0;
-        sqlstm.sqharm[0] = (unsigned int  )0;
-        sqlstm.sqadto[0] = (unsigned short )0;
-        sqlstm.sqtdso[0] = (unsigned short )0;
-        sqlstm.sqhstv[1] = (         void  *)v_mtitle;
-        sqlstm.sqhstl[1] = (unsigned int  )100;
-        sqlstm.sqhsts[1] = (         int  )0;
-        sqlstm.sqindv[1] = (         void  *)0;
-        sqlstm.sqinds[1] = (         int  )0;
-        sqlstm.sqharm[1] = (unsigned int  )0;
-        sqlstm.sqadto[1] = (unsigned short )0;
-        sqlstm.sqtdso[1] = (unsigned short )0;
-        sqlstm.sqhstv[2] = (         void  *)v_stime;
-        sqlstm.sqhstl[2] = (unsigned int  )30;
-        sqlstm.sqhsts[2] = (         int  )0;
-        sqlstm.sqindv[2] = (         void  *)0;
-        sqlstm.sqinds[2] = (         int  )0;
-        sqlstm.sqharm[2] = (unsigned int  )0;
-        sqlstm.sqadto[2] = (unsigned short )0;
-        sqlstm.sqtdso[2] = (unsigned short )0;
-        sqlstm.sqhstv[3] = (         void  *)v_seat;
-        sqlstm.sqhstl[3] = (unsigned int  )20;
-        sqlstm.sqhsts[3] = (         int  )0;
-        sqlstm.sqindv[3] = (         void  *)0;
-        sqlstm.sqinds[3] = (         int  )0;
-        sqlstm.sqharm[3] = (unsigned int  )0;
-        sqlstm.sqadto[3] = (unsigned short )0;
-        sqlstm.sqtdso[3] = (unsigned short )0;
-        sqlstm.sqhstv[4] = (         void  *)v_status;
-        sqlstm.sqhstl[4] = (unsigned int  )20;
-        sqlstm.sqhsts[4] = (         int  )0;
-        sqlstm.sqindv[4] = (         void  *)0;
-        sqlstm.sqinds[4] = (         int  )0;
-        sqlstm.sqharm[4] = (unsigned int  )0;
-        sqlstm.sqadto[4] = (unsigned short )0;
-        sqlstm.sqtdso[4] = (unsigned short )0;
-        sqlstm.sqphsv = sqlstm.sqhstv;
-        sqlstm.sqphsl = sqlstm.sqhstl;
-        sqlstm.sqphss = sqlstm.sqhsts;
-        sqlstm.sqpind = sqlstm.sqindv;
-        sqlstm.sqpins = sqlstm.sqinds;
-        sqlstm.sqparm = sqlstm.sqharm;
-        sqlstm.sqparc = sqlstm.sqharc;
-        sqlstm.sqpadto = sqlstm.sqadto;
-        sqlstm.sqptdso = sqlstm.sqtdso;
-        sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-        if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-        if(sqlca.sqlcode == 1403) break;
-        
-        v_mtitle[30] = '\0'; v_seat[19] = '\0'; v_stime[29] = '\0'; v_status[19] = '\0';
-
-        if (mode == 0) {
-            gotoxy(2, y);  printf("%4d", v_bid);
-            gotoxy(12, y); printf("%-30s", v_mtitle);
-            gotoxy(45, y); printf("%-20s", v_stime);
-            gotoxy(68, y); printf("%-10s", v_seat);
-            gotoxy(79, y); printf("%s", v_status);
-        } else {
-            gotoxy(2, y); 
-            printf("%4d     %-30s %-10s", v_bid, v_mtitle, v_seat);
-        }
-
-        y++;
-        count++;
-        
-        if (mode == 0 && y > 20) break; 
-        if (mode == 1 && y > 28) break; 
-    }
-    /* EXEC SQL CLOSE c_list; */ 
-
-{
-    struct sqlexd sqlstm;
-    sqlstm.sqlvsn = 13;
-    sqlstm.arrsiz = 5;
-    sqlstm.sqladtp = &sqladt;
-    sqlstm.sqltdsp = &sqltds;
-    sqlstm.iters = (unsigned int  )1;
-    sqlstm.offset = (unsigned int  )105;
-    sqlstm.cud = sqlcud0;
-    sqlstm.sqlest = (unsigned char  *)&sqlca;
-    sqlstm.sqlety = (unsigned short)4352;
-    sqlstm.occurs = (unsigned int  )0;
-    sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-    if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-    
-    if (count == 0) {
-        gotoxy(5, y); printf(">> ȸ   ϴ.");
-    }
-    
-    if (mode == 1) {
-        printf("\n-----------------------------------------------------------------");
-    }
-
-    return count;
-}
-
-void fn_signup()
-{
-    /* EXEC SQL BEGIN DECLARE SECTION; */ 
-
-        int  v_id;
-        char v_name[50];
-        char v_contact[20];
-        int  check_dup;
-    /* EXEC SQL END DECLARE SECTION; */ 
-
-
-    char temp[50];
-    int x = 30, y = 7;
-
-    clrscr();
-    print_screen("scr_signup.txt");
-
-    gotoxy(x, y);
-    if(fgets(temp, sizeof(temp), stdin) == NULL) return;
-    cleanup_input(temp);
-    if(strlen(temp) == 0) return;
-    v_id = atoi(temp);
-
-    /* EXEC SQL SELECT count(*) INTO :check_dup FROM Users WHERE user_id = :v_id; */ 
-
-{
-    struct sqlexd sqlstm;
-    sqlstm.sqlvsn = 13;
-    sqlstm.arrsiz = 5;
-    sqlstm.sqladtp = &sqladt;
-    sqlstm.sqltdsp = &sqltds;
-    sqlstm.stmt = "select count(*)  into :b0  from Users where user_id=:b1";
-    sqlstm.iters = (unsigned int  )1;
-    sqlstm.offset = (unsigned int  )120;
-    sqlstm.selerr = (unsigned short)1;
-    sqlstm.sqlpfmem = (unsigned int  )0;
-    sqlstm.cud = sqlcud0;
-    sqlstm.sqlest = (unsigned char  *)&sqlca;
-    sqlstm.sqlety = (unsigned short)4352;
-    sqlstm.occurs = (unsigned int  )0;
-    sqlstm.sqhstv[0] = (         void  *)&check_dup;
-    sqlstm.sqhstl[0] = (unsigned int  )sizeof(int);
-    sqlstm.sqhsts[0] = (         int  )0;
-    sqlstm.sqindv[0] = (         void  *)0;
-    sqlstm.sqinds[0] = (         int  )0;
-    sqlstm.sqharm[0] = (unsigned int  )0;
-    sqlstm.sqadto[0] = (unsigned short )0;
-    sqlstm.sqtdso[0] = (unsigned short )0;
-    sqlstm.sqhstv[1] = (         void  *)&v_id;
-    sqlstm.sqhstl[1] = (unsigned int  )sizeof(int);
-    sqlstm.sqhsts[1] = (         int  )0;
-    sqlstm.sqindv[1] = (         void  *)0;
-    sqlstm.sqinds[1] = (         int  )0;
-    sqlstm.sqharm[1] = (unsigned int  )0;
-    sqlstm.sqadto[1] = (unsigned short )0;
-    sqlstm.sqtdso[1] = (unsigned short )0;
-    sqlstm.sqphsv = sqlstm.sqhstv;
-    sqlstm.sqphsl = sqlstm.sqhstl;
-    sqlstm.sqphss = sqlstm.sqhsts;
-    sqlstm.sqpind = sqlstm.sqindv;
-    sqlstm.sqpins = sqlstm.sqinds;
-    sqlstm.sqparm = sqlstm.sqharm;
-    sqlstm.sqparc = sqlstm.sqharc;
-    sqlstm.sqpadto = sqlstm.sqadto;
-    sqlstm.sqptdso = sqlstm.sqtdso;
-    sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-    if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-    if (check_dup > 0) {
-        gotoxy(10, 16);
-        printf(">> [] ̹   IDԴϴ. (%d)", v_id);
-        getch(); return;
-    }
-
-    y += 2;   
-    gotoxy(x, y);
-    if(fgets(v_name, sizeof(v_name), stdin) == NULL) return;
-    cleanup_input(v_name);
-
-    y += 2;   
-    gotoxy(x, y);
-    if(fgets(v_contact, sizeof(v_contact), stdin) == NULL) return;
-    cleanup_input(v_contact);
-
-    /* EXEC SQL INSERT INTO Users (user_id, name, contact) VALUES (:v_id, :v_name, :v_contact); */ 
-
-{
-    struct sqlexd sqlstm;
-    sqlstm.sqlvsn = 13;
-    sqlstm.arrsiz = 5;
-    sqlstm.sqladtp = &sqladt;
-    sqlstm.sqltdsp = &sqltds;
-    sqlstm.stmt = "insert into Users (user_id,name,contact) values (:b0,:b1,\
-:b2)";
-    sqlstm.iters = (unsigned int  )1;
-    sqlstm.offset = (unsigned int  )143;
-    sqlstm.cud = sqlcud0;
-    sqlstm.sqlest = (unsigned char  *)&sqlca;
-    sqlstm.sqlety = (unsigned short)4352;
-    sqlstm.occurs = (unsigned int  )0;
-    sqlstm.sqhstv[0] = (         void  *)&v_id;
-    sqlstm.sqhstl[0] = (unsigned int  )sizeof(int);
-    sqlstm.sqhsts[0] = (         int  )0;
-    sqlstm.sqindv[0] = (         void  *)0;
-    sqlstm.sqinds[0] = (         int  )0;
-    sqlstm.sqharm[0] = (unsigned int  )0;
-    sqlstm.sqadto[0] = (unsigned short )0;
-    sqlstm.sqtdso[0] = (unsigned short )0;
-    sqlstm.sqhstv[1] = (         void  *)v_name;
-    sqlstm.sqhstl[1] = (unsigned int  )50;
-    sqlstm.sqhsts[1] = (         int  )0;
-    sqlstm.sqindv[1] = (         void  *)0;
-    sqlstm.sqinds[1] = (         int  )0;
-    sqlstm.sqharm[1] = (unsigned int  )0;
-    sqlstm.sqadto[1] = (unsigned short )0;
-    sqlstm.sqtdso[1] = (unsigned short )0;
-    sqlstm.sqhstv[2] = (         void  *)v_contact;
-    sqlstm.sqhstl[2] = (unsigned int  )20;
-    sqlstm.sqhsts[2] = (         int  )0;
-    sqlstm.sqindv[2] = (         void  *)0;
-    sqlstm.sqinds[2] = (         int  )0;
-    sqlstm.sqharm[2] = (unsigned int  )0;
-    sqlstm.sqadto[2] = (unsigned short )0;
-    sqlstm.sqtdso[2] = (unsigned short )0;
-    sqlstm.sqphsv = sqlstm.sqhstv;
-    sqlstm.sqphsl = sqlstm.sqhstl;
-    sqlstm.sqphss = sqlstm.sqhsts;
-    sqlstm.sqpind = sqlstm.sqindv;
-    sqlstm.sqpins = sqlstm.sqinds;
-    sqlstm.sqparm = sqlstm.sqharm;
-    sqlstm.sqparc = sqlstm.sqharc;
-    sqlstm.sqpadto = sqlstm.sqadto;
-    sqlstm.sqptdso = sqlstm.sqtdso;
-    sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-    if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-    
-    if (sqlca.sqlcode == 0) {
-        /* EXEC SQL COMMIT WORK; */ 
-
-{
-        struct sqlexd sqlstm;
-        sqlstm.sqlvsn = 13;
-        sqlstm.arrsiz = 5;
-        sqlstm.sqladtp = &sqladt;
-        sqlstm.sqltdsp = &sqltds;
-        sqlstm.iters = (unsigned int  )1;
-        sqlstm.offset = (unsigned int  )170;
-        sqlstm.cud = sqlcud0;
-        sqlstm.sqlest = (unsigned char  *)&sqlca;
-        sqlstm.sqlety = (unsigned short)4352;
-        sqlstm.occurs = (unsigned int  )0;
-        sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-        if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-        gotoxy(10, 16);
-        printf(">> [] ȸ Ϸ! ID [%d] αϼ.", v_id);
-    } else {
-        /* EXEC SQL ROLLBACK WORK; */ 
-
-{
-        struct sqlexd sqlstm;
-        sqlstm.sqlvsn = 13;
-        sqlstm.arrsiz = 5;
-        sqlstm.sqladtp = &sqladt;
-        sqlstm.sqltdsp = &sqltds;
-        sqlstm.iters = (unsigned int  )1;
-        sqlstm.offset = (unsigned int  )185;
-        sqlstm.cud = sqlcud0;
-        sqlstm.sqlest = (unsigned char  *)&sqlca;
-        sqlstm.sqlety = (unsigned short)4352;
-        sqlstm.occurs = (unsigned int  )0;
-        sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-        if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-        gotoxy(10, 16); printf(">> [] DB  ߻.");
-    }
-    getch(); 
-}
-
-//  : ȭ//¼ 
-int select_schedule_logic(int *out_sid, int *out_seatid, int *out_screen)
-{
-    /* EXEC SQL BEGIN DECLARE SECTION; */ 
-
-        int v_mid; char v_mtitle[100]; char v_rating[20]; int v_duration;
-        int v_sid; char v_stime[30]; int v_sprice; int v_screen_no;
-        int v_seatid; char v_row[5]; int v_col; int v_is_booked; 
-        int input_mid; int v_selected_sid; int input_seat_temp;
-        int check_schedule_movie; int v_selected_screen_no; int check_seat_screen;    
-    /* EXEC SQL END DECLARE SECTION; */ 
-
-
-    char temp[20];
-    int y;
-
-    clrscr();
-    print_screen("scr_movie.txt");
-    
-    /* EXEC SQL DECLARE c_movie_sub CURSOR FOR SELECT movie_id, title, rating, duration FROM Movies ORDER BY movie_id; */ 
-
-    /* EXEC SQL OPEN c_movie_sub; */ 
-
-{
-    struct sqlexd sqlstm;
-    sqlstm.sqlvsn = 13;
-    sqlstm.arrsiz = 5;
-    sqlstm.sqladtp = &sqladt;
-    sqlstm.sqltdsp = &sqltds;
-    sqlstm.stmt = sq0008;
-    sqlstm.iters = (unsigned int  )1;
-    sqlstm.offset = (unsigned int  )200;
-    sqlstm.selerr = (unsigned short)1;
-    sqlstm.sqlpfmem = (unsigned int  )0;
-    sqlstm.cud = sqlcud0;
-    sqlstm.sqlest = (unsigned char  *)&sqlca;
-    sqlstm.sqlety = (unsigned short)4352;
-    sqlstm.occurs = (unsigned int  )0;
-    sqlstm.sqcmod = (unsigned int )0;
-    sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-    if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-    y = 6;
-    while(1) {
-        /* EXEC SQL FETCH c_movie_sub INTO :v_mid, :v_mtitle, :v_rating, :v_duration; */ 
-
-{
-        struct sqlexd sqlstm;
-        sqlstm.sqlvsn = 13;
-        sqlstm.arrsiz = 5;
-        sqlstm.sqladtp = &sqladt;
-        sqlstm.sqltdsp = &sqltds;
-        sqlstm.iters = (unsigned int  )1;
-        sqlstm.offset = (unsigned int  )215;
-        sqlstm.selerr = (unsigned short)1;
-        sqlstm.sqlpfmem = (unsigned int  )0;
-        sqlstm.cud = sqlcud0;
-        sqlstm.sqlest = (unsigned char  *)&sqlca;
-        sqlstm.sqlety = (unsigned short)4352;
-        sqlstm.occurs = (unsigned int  )0;
-        sqlstm.sqfoff = (           int )0;
-        sqlstm.sqfmod = (unsigned int )2;
-        sqlstm.sqhstv[0] = (         void  *)&v_mid;
-        sqlstm.sqhstl[0] = (unsigned int  )sizeof(int);
-        sqlstm.sqhsts[0] = (         int  )0;
-        sqlstm.sqindv[0] = (         void  *)0;
-        sqlstm.sqinds[0] = (         int  )0;
-        sqlstm.sqharm[0] = (unsigned int  )0;
-        sqlstm.sqadto[0] = (unsigned short )0;
-        sqlstm.sqtdso[0] = (unsigned short )0;
-        sqlstm.sqhstv[1] = (         void  *)v_mtitle;
-        sqlstm.sqhstl[1] = (unsigned int  )100;
-        sqlstm.sqhsts[1] = (         int  )0;
-        sqlstm.sqindv[1] = (         void  *)0;
-        sqlstm.sqinds[1] = (         int  )0;
-        sqlstm.sqharm[1] = (unsigned int  )0;
-        sqlstm.sqadto[1] = (unsigned short )0;
-        sqlstm.sqtdso[1] = (unsigned short )0;
-        sqlstm.sqhstv[2] = (         void  *)v_rating;
-        sqlstm.sqhstl[2] = (unsigned int  )20;
-        sqlstm.sqhsts[2] = (         int  )0;
-        sqlstm.sqindv[2] = (         void  *)0;
-        sqlstm.sqinds[2] = (         int  )0;
-        sqlstm.sqharm[2] = (unsigned int  )0;
-        sqlstm.sqadto[2] = (unsigned short )0;
-        sqlstm.sqtdso[2] = (unsigned short )0;
-        sqlstm.sqhstv[3] = (         void  *)&v_duration;
-        sqlstm.sqhstl[3] = (unsigned int  )sizeof(int);
-        sqlstm.sqhsts[3] = (         int  )0;
-        sqlstm.sqindv[3] = (         void  *)0;
-        sqlstm.sqinds[3] = (         int  )0;
-        sqlstm.sqharm[3] = (unsigned int  )0;
-        sqlstm.sqadto[3] = (unsigned short )0;
-        sqlstm.sqtdso[3] = (unsigned short )0;
-        sqlstm.sqphsv = sqlstm.sqhstv;
-        sqlstm.sqphsl = sqlstm.sqhstl;
-        sqlstm.sqphss = sqlstm.sqhsts;
-        sqlstm.sqpind = sqlstm.sqindv;
-        sqlstm.sqpins = sqlstm.sqinds;
-        sqlstm.sqparm = sqlstm.sqharm;
-        sqlstm.sqparc = sqlstm.sqharc;
-        sqlstm.sqpadto = sqlstm.sqadto;
-        sqlstm.sqptdso = sqlstm.sqtdso;
-        sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-        if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-        if(sqlca.sqlcode == 1403) break;
-        v_mtitle[99] = '\0'; v_rating[19] = '\0';
-        gotoxy(2, y); printf("%4d", v_mid);   gotoxy(12, y); printf("%-30s", v_mtitle);   
-        gotoxy(45, y); printf("%-10s", v_rating); gotoxy(60, y); printf("%d", v_duration); y++;
-    }
-    /* EXEC SQL CLOSE c_movie_sub; */ 
-
-{
-    struct sqlexd sqlstm;
-    sqlstm.sqlvsn = 13;
-    sqlstm.arrsiz = 5;
-    sqlstm.sqladtp = &sqladt;
-    sqlstm.sqltdsp = &sqltds;
-    sqlstm.iters = (unsigned int  )1;
-    sqlstm.offset = (unsigned int  )246;
-    sqlstm.cud = sqlcud0;
-    sqlstm.sqlest = (unsigned char  *)&sqlca;
-    sqlstm.sqlety = (unsigned short)4352;
-    sqlstm.occurs = (unsigned int  )0;
-    sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-    if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-
-    gotoxy(2, y+2); 
-    printf(">>  [ȭ ID] : ");
-    
-    // [ ġ] Է ޱ
-    if(fgets(temp, sizeof(temp), stdin) == NULL) return 0; 
-    cleanup_input(temp);
-    if(strlen(temp) == 0) {
-        // ƹ͵ Է ϰ     ʵ 
-        return 0; 
-    }
-    input_mid = atoi(temp);
-
-    clrscr();
-    print_screen("scr_sch.txt");
-    /* EXEC SQL DECLARE c_sch_sub CURSOR FOR 
-        SELECT s.schedule_id, m.title, s.screen_no, to_char(s.start_time, 'YYYY-MM-DD HH24:MI'), s.price
-        FROM Schedules s, Movies m WHERE s.movie_id = m.movie_id AND s.movie_id = :input_mid ORDER BY s.start_time; */ 
-
-    /* EXEC SQL OPEN c_sch_sub; */ 
-
-{
-    struct sqlexd sqlstm;
-    sqlstm.sqlvsn = 13;
-    sqlstm.arrsiz = 5;
-    sqlstm.sqladtp = &sqladt;
-    sqlstm.sqltdsp = &sqltds;
-    sqlstm.stmt = sq0009;
-    sqlstm.iters = (unsigned int  )1;
-    sqlstm.offset = (unsigned int  )261;
-    sqlstm.selerr = (unsigned short)1;
-    sqlstm.sqlpfmem = (unsigned int  )0;
-    sqlstm.cud = sqlcud0;
-    sqlstm.sqlest = (unsigned char  *)&sqlca;
-    sqlstm.sqlety = (unsigned short)4352;
-    sqlstm.occurs = (unsigned int  )0;
-    sqlstm.sqcmod = (unsigned int )0;
-    sqlstm.sqhstv[0] = (         void  *)&input_mid;
-    sqlstm.sqhstl[0] = (unsigned int  )sizeof(int);
-    sqlstm.sqhsts[0] = (         int  )0;
-    sqlstm.sqindv[0] = (         void  *)0;
-    sqlstm.sqinds[0] = (         int  )0;
-    sqlstm.sqharm[0] = (unsigned int  )0;
-    sqlstm.sqadto[0] = (unsigned short )0;
-    sqlstm.sqtdso[0] = (unsigned short )0;
-    sqlstm.sqphsv = sqlstm.sqhstv;
-    sqlstm.sqphsl = sqlstm.sqhstl;
-    sqlstm.sqphss = sqlstm.sqhsts;
-    sqlstm.sqpind = sqlstm.sqindv;
-    sqlstm.sqpins = sqlstm.sqinds;
-    sqlstm.sqparm = sqlstm.sqharm;
-    sqlstm.sqparc = sqlstm.sqharc;
-    sqlstm.sqpadto = sqlstm.sqadto;
-    sqlstm.sqptdso = sqlstm.sqtdso;
-    sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-    if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-    y = 6;
-    while(1) {
-        /* EXEC SQL FETCH c_sch_sub INTO :v_sid, :v_mtitle, :v_screen_no, :v_stime, :v_sprice; */ 
-
-{
-        struct sqlexd sqlstm;
-        sqlstm.sqlvsn = 13;
-        sqlstm.arrsiz = 5;
-        sqlstm.sqladtp = &sqladt;
-        sqlstm.sqltdsp = &sqltds;
-        sqlstm.iters = (unsigned int  )1;
-        sqlstm.offset = (unsigned int  )280;
-        sqlstm.selerr = (unsigned short)1;
-        sqlstm.sqlpfmem = (unsigned int  )0;
-        sqlstm.cud = sqlcud0;
-        sqlstm.sqlest = (unsigned char  *)&sqlca;
-        sqlstm.sqlety = (unsigned short)4352;
-        sqlstm.occurs = (unsigned int  )0;
-        sqlstm.sqfoff = (           int )0;
-        sqlstm.sqfmod = (unsigned int )2;
-        sqlstm.sqhstv[0] = (         void  *)&v_sid;
-        sqlstm.sqhstl[0] = (unsigned int  )sizeof(int);
-        sqlstm.sqhsts[0] = (         int  )0;
-        sqlstm.sqindv[0] = (         void  *)0;
-        sqlstm.sqinds[0] = (         int  )0;
-        sqlstm.sqharm[0] = (unsigned int  )0;
-        sqlstm.sqadto[0] = (unsigned short )0;
-        sqlstm.sqtdso[0] = (unsigned short )0;
-        sqlstm.sqhstv[1] = (         void  *)v_mtitle;
-        sqlstm.sqhstl[1] = (unsigned int  )100;
-        sqlstm.sqhsts[1] = (         int  )0;
-        sqlstm.sqindv[1] = (         void  *)0;
-        sqlstm.sqinds[1] = (         int  )0;
-        sqlstm.sqharm[1] = (unsigned int  )0;
-        sqlstm.sqadto[1] = (unsigned short )0;
-        sqlstm.sqtdso[1] = (unsigned short )0;
-        sqlstm.sqhstv[2] = (         void  *)&v_screen_no;
-        sqlstm.sqhstl[2] = (unsigned int  )sizeof(int);
-        sqlstm.sqhsts[2] = (         int  )0;
-        sqlstm.sqindv[2] = (         void  *)0;
-        sqlstm.sqinds[2] = (         int  )0;
-        sqlstm.sqharm[2] = (unsigned int  )0;
-        sqlstm.sqadto[2] = (unsigned short )0;
-        sqlstm.sqtdso[2] = (unsigned short )0;
-        sqlstm.sqhstv[3] = (         void  *)v_stime;
-        sqlstm.sqhstl[3] = (unsigned int  )30;
-        sqlstm.sqhsts[3] = (         int  )0;
-        sqlstm.sqindv[3] = (         void  *)0;
-        sqlstm.sqinds[3] = (         int  )0;
-        sqlstm.sqharm[3] = (unsigned int  )0;
-        sqlstm.sqadto[3] = (unsigned short )0;
-        sqlstm.sqtdso[3] = (unsigned short )0;
-        sqlstm.sqhstv[4] = (         void  *)&v_sprice;
-        sqlstm.sqhstl[4] = (unsigned int  )sizeof(int);
-        sqlstm.sqhsts[4] = (         int  )0;
-        sqlstm.sqindv[4] = (         void  *)0;
-        sqlstm.sqinds[4] = (         int  )0;
-        sqlstm.sqharm[4] = (unsigned int  )0;
-        sqlstm.sqadto[4] = (unsigned short )0;
-        sqlstm.sqtdso[4] = (unsigned short )0;
-        sqlstm.sqphsv = sqlstm.sqhstv;
-        sqlstm.sqphsl = sqlstm.sqhstl;
-        sqlstm.sqphss = sqlstm.sqhsts;
-        sqlstm.sqpind = sqlstm.sqindv;
-        sqlstm.sqpins = sqlstm.sqinds;
-        sqlstm.sqparm = sqlstm.sqharm;
-        sqlstm.sqparc = sqlstm.sqharc;
-        sqlstm.sqpadto = sqlstm.sqadto;
-        sqlstm.sqptdso = sqlstm.sqtdso;
-        sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-        if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-        if(sqlca.sqlcode == 1403) break; v_mtitle[99] = '\0'; v_stime[29] = '\0';
-        gotoxy(2, y); printf("%4d", v_sid); gotoxy(12, y); printf("%-20s", v_mtitle);   
-        gotoxy(38, y); printf("%d", v_screen_no); gotoxy(48, y); printf("%-16s", v_stime); gotoxy(68, y); printf("%d", v_sprice); y++;
-    }
-    /* EXEC SQL CLOSE c_sch_sub; */ 
-
-{
-    struct sqlexd sqlstm;
-    sqlstm.sqlvsn = 13;
-    sqlstm.arrsiz = 5;
-    sqlstm.sqladtp = &sqladt;
-    sqlstm.sqltdsp = &sqltds;
-    sqlstm.iters = (unsigned int  )1;
-    sqlstm.offset = (unsigned int  )315;
-    sqlstm.cud = sqlcud0;
-    sqlstm.sqlest = (unsigned char  *)&sqlca;
-    sqlstm.sqlety = (unsigned short)4352;
-    sqlstm.occurs = (unsigned int  )0;
-    sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-    if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-
-    if (y == 6) { printf("\n\n     >>   ϴ. (ͷ )\n"); getch(); return 0; }
-
-    gotoxy(2, y+2); printf(">>  [ ID] : ");
-    if(fgets(temp, sizeof(temp), stdin) == NULL) return 0; cleanup_input(temp);
-    if(strlen(temp) == 0) return 0; 
-    *out_sid = atoi(temp); v_selected_sid = *out_sid;   
-
-    if (v_selected_sid == 0) { printf("\n    >>> [] ȿ   IDԴϴ.\n"); getch(); return 0; }
-
-    /* EXEC SQL SELECT count(*) INTO :check_schedule_movie FROM Schedules WHERE schedule_id = :v_selected_sid AND movie_id = :input_mid; */ 
-
-{
-    struct sqlexd sqlstm;
-    sqlstm.sqlvsn = 13;
-    sqlstm.arrsiz = 5;
-    sqlstm.sqladtp = &sqladt;
-    sqlstm.sqltdsp = &sqltds;
-    sqlstm.stmt = "select count(*)  into :b0  from Schedules where (schedule\
-_id=:b1 and movie_id=:b2)";
-    sqlstm.iters = (unsigned int  )1;
-    sqlstm.offset = (unsigned int  )330;
-    sqlstm.selerr = (unsigned short)1;
-    sqlstm.sqlpfmem = (unsigned int  )0;
-    sqlstm.cud = sqlcud0;
-    sqlstm.sqlest = (unsigned char  *)&sqlca;
-    sqlstm.sqlety = (unsigned short)4352;
-    sqlstm.occurs = (unsigned int  )0;
-    sqlstm.sqhstv[0] = (         void  *)&check_schedule_movie;
-    sqlstm.sqhstl[0] = (unsigned int  )sizeof(int);
-    sqlstm.sqhsts[0] = (         int  )0;
-    sqlstm.sqindv[0] = (         void  *)0;
-    sqlstm.sqinds[0] = (         int  )0;
-    sqlstm.sqharm[0] = (unsigned int  )0;
-    sqlstm.sqadto[0] = (unsigned short )0;
-    sqlstm.sqtdso[0] = (unsigned short )0;
-    sqlstm.sqhstv[1] = (         void  *)&v_selected_sid;
-    sqlstm.sqhstl[1] = (unsigned int  )sizeof(int);
-    sqlstm.sqhsts[1] = (         int  )0;
-    sqlstm.sqindv[1] = (         void  *)0;
-    sqlstm.sqinds[1] = (         int  )0;
-    sqlstm.sqharm[1] = (unsigned int  )0;
-    sqlstm.sqadto[1] = (unsigned short )0;
-    sqlstm.sqtdso[1] = (unsigned short )0;
-    sqlstm.sqhstv[2] = (         void  *)&input_mid;
-    sqlstm.sqhstl[2] = (unsigned int  )sizeof(int);
-    sqlstm.sqhsts[2] = (         int  )0;
-    sqlstm.sqindv[2] = (         void  *)0;
-    sqlstm.sqinds[2] = (         int  )0;
-    sqlstm.sqharm[2] = (unsigned int  )0;
-    sqlstm.sqadto[2] = (unsigned short )0;
-    sqlstm.sqtdso[2] = (unsigned short )0;
-    sqlstm.sqphsv = sqlstm.sqhstv;
-    sqlstm.sqphsl = sqlstm.sqhstl;
-    sqlstm.sqphss = sqlstm.sqhsts;
-    sqlstm.sqpind = sqlstm.sqindv;
-    sqlstm.sqpins = sqlstm.sqinds;
-    sqlstm.sqparm = sqlstm.sqharm;
-    sqlstm.sqparc = sqlstm.sqharc;
-    sqlstm.sqpadto = sqlstm.sqadto;
-    sqlstm.sqptdso = sqlstm.sqtdso;
-    sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-    if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-    if (check_schedule_movie == 0) { printf("\n    >>> []  ȭ  ƴմϴ.\n"); getch(); return 0; }
-
-    /* EXEC SQL SELECT screen_no INTO :v_selected_screen_no FROM Schedules WHERE schedule_id = :v_selected_sid; */ 
-
-{
-    struct sqlexd sqlstm;
-    sqlstm.sqlvsn = 13;
-    sqlstm.arrsiz = 5;
-    sqlstm.sqladtp = &sqladt;
-    sqlstm.sqltdsp = &sqltds;
-    sqlstm.stmt = "select screen_no into :b0  from Schedules where schedule_\
-id=:b1";
-    sqlstm.iters = (unsigned int  )1;
-    sqlstm.offset = (unsigned int  )357;
-    sqlstm.selerr = (unsigned short)1;
-    sqlstm.sqlpfmem = (unsigned int  )0;
-    sqlstm.cud = sqlcud0;
-    sqlstm.sqlest = (unsigned char  *)&sqlca;
-    sqlstm.sqlety = (unsigned short)4352;
-    sqlstm.occurs = (unsigned int  )0;
-    sqlstm.sqhstv[0] = (         void  *)&v_selected_screen_no;
-    sqlstm.sqhstl[0] = (unsigned int  )sizeof(int);
-    sqlstm.sqhsts[0] = (         int  )0;
-    sqlstm.sqindv[0] = (         void  *)0;
-    sqlstm.sqinds[0] = (         int  )0;
-    sqlstm.sqharm[0] = (unsigned int  )0;
-    sqlstm.sqadto[0] = (unsigned short )0;
-    sqlstm.sqtdso[0] = (unsigned short )0;
-    sqlstm.sqhstv[1] = (         void  *)&v_selected_sid;
-    sqlstm.sqhstl[1] = (unsigned int  )sizeof(int);
-    sqlstm.sqhsts[1] = (         int  )0;
-    sqlstm.sqindv[1] = (         void  *)0;
-    sqlstm.sqinds[1] = (         int  )0;
-    sqlstm.sqharm[1] = (unsigned int  )0;
-    sqlstm.sqadto[1] = (unsigned short )0;
-    sqlstm.sqtdso[1] = (unsigned short )0;
-    sqlstm.sqphsv = sqlstm.sqhstv;
-    sqlstm.sqphsl = sqlstm.sqhstl;
-    sqlstm.sqphss = sqlstm.sqhsts;
-    sqlstm.sqpind = sqlstm.sqindv;
-    sqlstm.sqpins = sqlstm.sqinds;
-    sqlstm.sqparm = sqlstm.sqharm;
-    sqlstm.sqparc = sqlstm.sqharc;
-    sqlstm.sqpadto = sqlstm.sqadto;
-    sqlstm.sqptdso = sqlstm.sqtdso;
-    sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-    if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-    *out_screen = v_selected_screen_no; 
-
-    while(1) {   
-        clrscr();
-        print_screen("scr_seat.txt");
-        /* EXEC SQL DECLARE c_seat_sub CURSOR FOR SELECT seat_id, screen_no, row_code, col_code FROM Seats WHERE screen_no = :v_selected_screen_no ORDER BY row_code, col_code; */ 
-   
-        /* EXEC SQL OPEN c_seat_sub; */ 
-
-{
-        struct sqlexd sqlstm;
-        sqlstm.sqlvsn = 13;
-        sqlstm.arrsiz = 5;
-        sqlstm.sqladtp = &sqladt;
-        sqlstm.sqltdsp = &sqltds;
-        sqlstm.stmt = sq0012;
-        sqlstm.iters = (unsigned int  )1;
-        sqlstm.offset = (unsigned int  )380;
-        sqlstm.selerr = (unsigned short)1;
-        sqlstm.sqlpfmem = (unsigned int  )0;
-        sqlstm.cud = sqlcud0;
-        sqlstm.sqlest = (unsigned char  *)&sqlca;
-        sqlstm.sqlety = (unsigned short)4352;
-        sqlstm.occurs = (unsigned int  )0;
-        sqlstm.sqcmod = (unsigned int )0;
-        sqlstm.sqhstv[0] = (         void  *)&v_selected_screen_no;
-        sqlstm.sqhstl[0] = (unsigned int  )sizeof(int);
-        sqlstm.sqhsts[0] = (         int  )0;
-        sqlstm.sqindv[0] = (         void  *)0;
-        sqlstm.sqinds[0] = (         int  )0;
-        sqlstm.sqharm[0] = (unsigned int  )0;
-        sqlstm.sqadto[0] = (unsigned short )0;
-        sqlstm.sqtdso[0] = (unsigned short )0;
-        sqlstm.sqphsv = sqlstm.sqhstv;
-        sqlstm.sqphsl = sqlstm.sqhstl;
-        sqlstm.sqphss = sqlstm.sqhsts;
-        sqlstm.sqpind = sqlstm.sqindv;
-        sqlstm.sqpins = sqlstm.sqinds;
-        sqlstm.sqparm = sqlstm.sqharm;
-        sqlstm.sqparc = sqlstm.sqharc;
-        sqlstm.sqpadto = sqlstm.sqadto;
-        sqlstm.sqptdso = sqlstm.sqtdso;
-        sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-        if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-        y = 6;
-        while(1) {
-            /* EXEC SQL FETCH c_seat_sub INTO :v_seatid, :v_screen_no, :v_row, :v_col; */ 
-
-{
-            struct sqlexd sqlstm;
-            sqlstm.sqlvsn = 13;
-            sqlstm.arrsiz = 5;
-            sqlstm.sqladtp = &sqladt;
-            sqlstm.sqltdsp = &sqltds;
-            sqlstm.iters = (unsigned int  )1;
-            sqlstm.offset = (unsigned int  )399;
-            sqlstm.selerr = (unsigned short)1;
-            sqlstm.sqlpfmem = (unsigned int  )0;
-            sqlstm.cud = sqlcud0;
-            sqlstm.sqlest = (unsigned char  *)&sqlca;
-            sqlstm.sqlety = (unsigned short)4352;
-            sqlstm.occurs = (unsigned int  )0;
-            sqlstm.sqfoff = (           int )0;
-            sqlstm.sqfmod = (unsigned int )2;
-            sqlstm.sqhstv[0] = (         void  *)&v_seatid;
-            sqlstm.sqhstl[0] = (unsigned int  )sizeof(int);
-            sqlstm.sqhsts[0] = (         int  )0;
-            sqlstm.sqindv[0] = (         void  *)0;
-            sqlstm.sqinds[0] = (         int  )0;
-            sqlstm.sqharm[0] = (unsigned int  )0;
-            sqlstm.sqadto[0] = (unsigned short )0;
-            sqlstm.sqtdso[0] = (unsigned short )0;
-            sqlstm.sqhstv[1] = (         void  *)&v_screen_no;
-            sqlstm.sqhstl[1] = (unsigned int  )sizeof(int);
-            sqlstm.sqhsts[1] = (         int  )0;
-            sqlstm.sqindv[1] = (         void  *)0;
-            sqlstm.sqinds[1] = (         int  )0;
-            sqlstm.sqharm[1] = (unsigned int  )0;
-            sqlstm.sqadto[1] = (unsigned short )0;
-            sqlstm.sqtdso[1] = (unsigned short )0;
-            sqlstm.sqhstv[2] = (         void  *)v_row;
-            sqlstm.sqhstl[2] = (unsigned int  )5;
-            sqlstm.sqhsts[2] = (         int  )0;
-            sqlstm.sqindv[2] = (         void  *)0;
-            sqlstm.sqinds[2] = (         int  )0;
-            sqlstm.sqharm[2] = (unsigned int  )0;
-            sqlstm.sqadto[2] = (unsigned short )0;
-            sqlstm.sqtdso[2] = (unsigned short )0;
-            sqlstm.sqhstv[3] = (         void  *)&v_col;
-            sqlstm.sqhstl[3] = (unsigned int  )sizeof(int);
-            sqlstm.sqhsts[3] = (         int  )0;
-            sqlstm.sqindv[3] = (         void  *)0;
-            sqlstm.sqinds[3] = (         int  )0;
-            sqlstm.sqharm[3] = (unsigned int  )0;
-            sqlstm.sqadto[3] = (unsigned short )0;
-            sqlstm.sqtdso[3] = (unsigned short )0;
-            sqlstm.sqphsv = sqlstm.sqhstv;
-            sqlstm.sqphsl = sqlstm.sqhstl;
-            sqlstm.sqphss = sqlstm.sqhsts;
-            sqlstm.sqpind = sqlstm.sqindv;
-            sqlstm.sqpins = sqlstm.sqinds;
-            sqlstm.sqparm = sqlstm.sqharm;
-            sqlstm.sqparc = sqlstm.sqharc;
-            sqlstm.sqpadto = sqlstm.sqadto;
-            sqlstm.sqptdso = sqlstm.sqtdso;
-            sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-            if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-            if(sqlca.sqlcode == 1403) break; v_row[4] = '\0';
-            /* EXEC SQL SELECT count(*) INTO :v_is_booked FROM Bookings WHERE schedule_id = :v_selected_sid AND seat_id = :v_seatid; */ 
-
-{
-            struct sqlexd sqlstm;
-            sqlstm.sqlvsn = 13;
-            sqlstm.arrsiz = 5;
-            sqlstm.sqladtp = &sqladt;
-            sqlstm.sqltdsp = &sqltds;
-            sqlstm.stmt = "select count(*)  into :b0  from Bookings where (s\
-chedule_id=:b1 and seat_id=:b2)";
-            sqlstm.iters = (unsigned int  )1;
-            sqlstm.offset = (unsigned int  )430;
-            sqlstm.selerr = (unsigned short)1;
-            sqlstm.sqlpfmem = (unsigned int  )0;
-            sqlstm.cud = sqlcud0;
-            sqlstm.sqlest = (unsigned char  *)&sqlca;
-            sqlstm.sqlety = (unsigned short)4352;
-            sqlstm.occurs = (unsigned int  )0;
-            sqlstm.sqhstv[0] = (         void  *)&v_is_booked;
-            sqlstm.sqhstl[0] = (unsigned int  )sizeof(int);
-            sqlstm.sqhsts[0] = (         int  )0;
-            sqlstm.sqindv[0] = (         void  *)0;
-            sqlstm.sqinds[0] = (         int  )0;
-            sqlstm.sqharm[0] = (unsigned int  )0;
-            sqlstm.sqadto[0] = (unsigned short )0;
-            sqlstm.sqtdso[0] = (unsigned short )0;
-            sqlstm.sqhstv[1] = (         void  *)&v_selected_sid;
-            sqlstm.sqhstl[1] = (unsigned int  )sizeof(int);
-            sqlstm.sqhsts[1] = (         int  )0;
-            sqlstm.sqindv[1] = (         void  *)0;
-            sqlstm.sqinds[1] = (         int  )0;
-            sqlstm.sqharm[1] = (unsigned int  )0;
-            sqlstm.sqadto[1] = (unsigned short )0;
-            sqlstm.sqtdso[1] = (unsigned short )0;
-            sqlstm.sqhstv[2] = (         void  *)&v_seatid;
-            sqlstm.sqhstl[2] = (unsigned int  )sizeof(int);
-            sqlstm.sqhsts[2] = (         int  )0;
-            sqlstm.sqindv[2] = (         void  *)0;
-            sqlstm.sqinds[2] = (         int  )0;
-            sqlstm.sqharm[2] = (unsigned int  )0;
-            sqlstm.sqadto[2] = (unsigned short )0;
-            sqlstm.sqtdso[2] = (unsigned short )0;
-            sqlstm.sqphsv = sqlstm.sqhstv;
-            sqlstm.sqphsl = sqlstm.sqhstl;
-            sqlstm.sqphss = sqlstm.sqhsts;
-            sqlstm.sqpind = sqlstm.sqindv;
-            sqlstm.sqpins = sqlstm.sqinds;
-            sqlstm.sqparm = sqlstm.sqharm;
-            sqlstm.sqparc = sqlstm.sqharc;
-            sqlstm.sqpadto = sqlstm.sqadto;
-            sqlstm.sqptdso = sqlstm.sqtdso;
-            sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-            if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-            gotoxy(2, y); printf("%4d", v_seatid); gotoxy(10, y); 
-            if (v_is_booked > 0) printf("[X] "); else printf("[O] ");
-            gotoxy(28, y); printf("%d", v_screen_no); gotoxy(40, y); printf("%s", v_row); gotoxy(50, y); printf("%d", v_col); y++;
-        }
-        /* EXEC SQL CLOSE c_seat_sub; */ 
-
-{
-        struct sqlexd sqlstm;
-        sqlstm.sqlvsn = 13;
-        sqlstm.arrsiz = 5;
-        sqlstm.sqladtp = &sqladt;
-        sqlstm.sqltdsp = &sqltds;
-        sqlstm.iters = (unsigned int  )1;
-        sqlstm.offset = (unsigned int  )457;
-        sqlstm.cud = sqlcud0;
-        sqlstm.sqlest = (unsigned char  *)&sqlca;
-        sqlstm.sqlety = (unsigned short)4352;
-        sqlstm.occurs = (unsigned int  )0;
-        sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-        if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-        
-        if (y == 6) { gotoxy(5, 8); printf("¼ Ͱ ϴ."); getch(); return 0; }
-
-        gotoxy(2, y+2); printf(">>  [¼ ID] : ");
-        if(fgets(temp, sizeof(temp), stdin) == NULL) return 0; cleanup_input(temp);
-        if(strlen(temp) == 0) return 0; input_seat_temp = atoi(temp);
-
-        if (input_seat_temp == 0) { gotoxy(2, y+4); printf(">>> [] ȿ  IDԴϴ."); getch(); continue; }
-
-        /* EXEC SQL SELECT count(*) INTO :check_seat_screen FROM Seats WHERE seat_id = :input_seat_temp AND screen_no = :v_selected_screen_no; */ 
-
-{
-        struct sqlexd sqlstm;
-        sqlstm.sqlvsn = 13;
-        sqlstm.arrsiz = 5;
-        sqlstm.sqladtp = &sqladt;
-        sqlstm.sqltdsp = &sqltds;
-        sqlstm.stmt = "select count(*)  into :b0  from Seats where (seat_id=\
-:b1 and screen_no=:b2)";
-        sqlstm.iters = (unsigned int  )1;
-        sqlstm.offset = (unsigned int  )472;
-        sqlstm.selerr = (unsigned short)1;
-        sqlstm.sqlpfmem = (unsigned int  )0;
-        sqlstm.cud = sqlcud0;
-        sqlstm.sqlest = (unsigned char  *)&sqlca;
-        sqlstm.sqlety = (unsigned short)4352;
-        sqlstm.occurs = (unsigned int  )0;
-        sqlstm.sqhstv[0] = (         void  *)&check_seat_screen;
-        sqlstm.sqhstl[0] = (unsigned int  )sizeof(int);
-        sqlstm.sqhsts[0] = (         int  )0;
-        sqlstm.sqindv[0] = (         void  *)0;
-        sqlstm.sqinds[0] = (         int  )0;
-        sqlstm.sqharm[0] = (unsigned int  )0;
-        sqlstm.sqadto[0] = (unsigned short )0;
-        sqlstm.sqtdso[0] = (unsigned short )0;
-        sqlstm.sqhstv[1] = (         void  *)&input_seat_temp;
-        sqlstm.sqhstl[1] = (unsigned int  )sizeof(int);
-        sqlstm.sqhsts[1] = (         int  )0;
-        sqlstm.sqindv[1] = (         void  *)0;
-        sqlstm.sqinds[1] = (         int  )0;
-        sqlstm.sqharm[1] = (unsigned int  )0;
-        sqlstm.sqadto[1] = (unsigned short )0;
-        sqlstm.sqtdso[1] = (unsigned short )0;
-        sqlstm.sqhstv[2] = (         void  *)&v_selected_screen_no;
-        sqlstm.sqhstl[2] = (unsigned int  )sizeof(int);
-        sqlstm.sqhsts[2] = (         int  )0;
-        sqlstm.sqindv[2] = (         void  *)0;
-        sqlstm.sqinds[2] = (         int  )0;
-        sqlstm.sqharm[2] = (unsigned int  )0;
-        sqlstm.sqadto[2] = (unsigned short )0;
-        sqlstm.sqtdso[2] = (unsigned short )0;
-        sqlstm.sqphsv = sqlstm.sqhstv;
-        sqlstm.sqphsl = sqlstm.sqhstl;
-        sqlstm.sqphss = sqlstm.sqhsts;
-        sqlstm.sqpind = sqlstm.sqindv;
-        sqlstm.sqpins = sqlstm.sqinds;
-        sqlstm.sqparm = sqlstm.sqharm;
-        sqlstm.sqparc = sqlstm.sqharc;
-        sqlstm.sqpadto = sqlstm.sqadto;
-        sqlstm.sqptdso = sqlstm.sqtdso;
-        sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-        if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-        if (check_seat_screen == 0) { gotoxy(2, y+4); printf(">>> []  󿵰 ¼ ƴմϴ!"); getch(); continue; }
-        
-        /* EXEC SQL SELECT count(*) INTO :v_is_booked FROM Bookings WHERE schedule_id = :v_selected_sid AND seat_id = :input_seat_temp; */ 
-
-{
-        struct sqlexd sqlstm;
-        sqlstm.sqlvsn = 13;
-        sqlstm.arrsiz = 5;
-        sqlstm.sqladtp = &sqladt;
-        sqlstm.sqltdsp = &sqltds;
-        sqlstm.stmt = "select count(*)  into :b0  from Bookings where (sched\
-ule_id=:b1 and seat_id=:b2)";
-        sqlstm.iters = (unsigned int  )1;
-        sqlstm.offset = (unsigned int  )499;
-        sqlstm.selerr = (unsigned short)1;
-        sqlstm.sqlpfmem = (unsigned int  )0;
-        sqlstm.cud = sqlcud0;
-        sqlstm.sqlest = (unsigned char  *)&sqlca;
-        sqlstm.sqlety = (unsigned short)4352;
-        sqlstm.occurs = (unsigned int  )0;
-        sqlstm.sqhstv[0] = (         void  *)&v_is_booked;
-        sqlstm.sqhstl[0] = (unsigned int  )sizeof(int);
-        sqlstm.sqhsts[0] = (         int  )0;
-        sqlstm.sqindv[0] = (         void  *)0;
-        sqlstm.sqinds[0] = (         int  )0;
-        sqlstm.sqharm[0] = (unsigned int  )0;
-        sqlstm.sqadto[0] = (unsigned short )0;
-        sqlstm.sqtdso[0] = (unsigned short )0;
-        sqlstm.sqhstv[1] = (         void  *)&v_selected_sid;
-        sqlstm.sqhstl[1] = (unsigned int  )sizeof(int);
-        sqlstm.sqhsts[1] = (         int  )0;
-        sqlstm.sqindv[1] = (         void  *)0;
-        sqlstm.sqinds[1] = (         int  )0;
-        sqlstm.sqharm[1] = (unsigned int  )0;
-        sqlstm.sqadto[1] = (unsigned short )0;
-        sqlstm.sqtdso[1] = (unsigned short )0;
-        sqlstm.sqhstv[2] = (         void  *)&input_seat_temp;
-        sqlstm.sqhstl[2] = (unsigned int  )sizeof(int);
-        sqlstm.sqhsts[2] = (         int  )0;
-        sqlstm.sqindv[2] = (         void  *)0;
-        sqlstm.sqinds[2] = (         int  )0;
-        sqlstm.sqharm[2] = (unsigned int  )0;
-        sqlstm.sqadto[2] = (unsigned short )0;
-        sqlstm.sqtdso[2] = (unsigned short )0;
-        sqlstm.sqphsv = sqlstm.sqhstv;
-        sqlstm.sqphsl = sqlstm.sqhstl;
-        sqlstm.sqphss = sqlstm.sqhsts;
-        sqlstm.sqpind = sqlstm.sqindv;
-        sqlstm.sqpins = sqlstm.sqinds;
-        sqlstm.sqparm = sqlstm.sqharm;
-        sqlstm.sqparc = sqlstm.sqharc;
-        sqlstm.sqpadto = sqlstm.sqadto;
-        sqlstm.sqptdso = sqlstm.sqtdso;
-        sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-        if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-        if (v_is_booked > 0) { gotoxy(2, y+4); printf(">>> [] ̹  ¼Դϴ!"); getch(); continue; } else { *out_seatid = input_seat_temp; break; }
-    }
-    return 1;
-}
-
-// 2. ϱ
-void fn_booking_flow()
-{
-    /* EXEC SQL BEGIN DECLARE SECTION; */ 
-
-        int input_uid; int input_sid; int input_seatid; int check_user;
-    /* EXEC SQL END DECLARE SECTION; */ 
-
-    int screen_no_dummy; char temp[20];
-
-    clrscr();
-    printf("\n\n    [ Ȯ]\n");
-    printf("    ȸ ID Էϼ: ");
-    
-    if(fgets(temp, sizeof(temp), stdin) == NULL) return; cleanup_input(temp);
-    if(strlen(temp) == 0) return; input_uid = atoi(temp);
-
-    /* EXEC SQL SELECT count(*) INTO :check_user FROM Users WHERE user_id = :input_uid; */ 
-
-{
-    struct sqlexd sqlstm;
-    sqlstm.sqlvsn = 13;
-    sqlstm.arrsiz = 5;
-    sqlstm.sqladtp = &sqladt;
-    sqlstm.sqltdsp = &sqltds;
-    sqlstm.stmt = "select count(*)  into :b0  from Users where user_id=:b1";
-    sqlstm.iters = (unsigned int  )1;
-    sqlstm.offset = (unsigned int  )526;
-    sqlstm.selerr = (unsigned short)1;
-    sqlstm.sqlpfmem = (unsigned int  )0;
-    sqlstm.cud = sqlcud0;
-    sqlstm.sqlest = (unsigned char  *)&sqlca;
-    sqlstm.sqlety = (unsigned short)4352;
-    sqlstm.occurs = (unsigned int  )0;
-    sqlstm.sqhstv[0] = (         void  *)&check_user;
-    sqlstm.sqhstl[0] = (unsigned int  )sizeof(int);
-    sqlstm.sqhsts[0] = (         int  )0;
-    sqlstm.sqindv[0] = (         void  *)0;
-    sqlstm.sqinds[0] = (         int  )0;
-    sqlstm.sqharm[0] = (unsigned int  )0;
-    sqlstm.sqadto[0] = (unsigned short )0;
-    sqlstm.sqtdso[0] = (unsigned short )0;
-    sqlstm.sqhstv[1] = (         void  *)&input_uid;
-    sqlstm.sqhstl[1] = (unsigned int  )sizeof(int);
-    sqlstm.sqhsts[1] = (         int  )0;
-    sqlstm.sqindv[1] = (         void  *)0;
-    sqlstm.sqinds[1] = (         int  )0;
-    sqlstm.sqharm[1] = (unsigned int  )0;
-    sqlstm.sqadto[1] = (unsigned short )0;
-    sqlstm.sqtdso[1] = (unsigned short )0;
-    sqlstm.sqphsv = sqlstm.sqhstv;
-    sqlstm.sqphsl = sqlstm.sqhstl;
-    sqlstm.sqphss = sqlstm.sqhsts;
-    sqlstm.sqpind = sqlstm.sqindv;
-    sqlstm.sqpins = sqlstm.sqinds;
-    sqlstm.sqparm = sqlstm.sqharm;
-    sqlstm.sqparc = sqlstm.sqharc;
-    sqlstm.sqpadto = sqlstm.sqadto;
-    sqlstm.sqptdso = sqlstm.sqtdso;
-    sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-    if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-    if (check_user == 0) { printf("\n    >>> []  ʴ ȸ IDԴϴ. (ID: %d)\n", input_uid); getch(); return; }
-
-    if (select_schedule_logic(&input_sid, &input_seatid, &screen_no_dummy) == 0) return;   
-
-    /* EXEC SQL INSERT INTO Bookings (user_id, schedule_id, seat_id, status) VALUES (:input_uid, :input_sid, :input_seatid, 'Ϸ'); */ 
-
-{
-    struct sqlexd sqlstm;
-    sqlstm.sqlvsn = 13;
-    sqlstm.arrsiz = 5;
-    sqlstm.sqladtp = &sqladt;
-    sqlstm.sqltdsp = &sqltds;
-    sqlstm.stmt = "insert into Bookings (user_id,schedule_id,seat_id,status)\
- values (:b0,:b1,:b2,'Ϸ')";
-    sqlstm.iters = (unsigned int  )1;
-    sqlstm.offset = (unsigned int  )549;
-    sqlstm.cud = sqlcud0;
-    sqlstm.sqlest = (unsigned char  *)&sqlca;
-    sqlstm.sqlety = (unsigned short)4352;
-    sqlstm.occurs = (unsigned int  )0;
-    sqlstm.sqhstv[0] = (         void  *)&input_uid;
-    sqlstm.sqhstl[0] = (unsigned int  )sizeof(int);
-    sqlstm.sqhsts[0] = (         int  )0;
-    sqlstm.sqindv[0] = (         void  *)0;
-    sqlstm.sqinds[0] = (         int  )0;
-    sqlstm.sqharm[0] = (unsigned int  )0;
-    sqlstm.sqadto[0] = (unsigned short )0;
-    sqlstm.sqtdso[0] = (unsigned short )0;
-    sqlstm.sqhstv[1] = (         void  *)&input_sid;
-    sqlstm.sqhstl[1] = (unsigned int  )sizeof(int);
-    sqlstm.sqhsts[1] = (         int  )0;
-    sqlstm.sqindv[1] = (         void  *)0;
-    sqlstm.sqinds[1] = (         int  )0;
-    sqlstm.sqharm[1] = (unsigned int  )0;
-    sqlstm.sqadto[1] = (unsigned short )0;
-    sqlstm.sqtdso[1] = (unsigned short )0;
-    sqlstm.sqhstv[2] = (         void  *)&input_seatid;
-    sqlstm.sqhstl[2] = (unsigned int  )sizeof(int);
-    sqlstm.sqhsts[2] = (         int  )0;
-    sqlstm.sqindv[2] = (         void  *)0;
-    sqlstm.sqinds[2] = (         int  )0;
-    sqlstm.sqharm[2] = (unsigned int  )0;
-    sqlstm.sqadto[2] = (unsigned short )0;
-    sqlstm.sqtdso[2] = (unsigned short )0;
-    sqlstm.sqphsv = sqlstm.sqhstv;
-    sqlstm.sqphsl = sqlstm.sqhstl;
-    sqlstm.sqphss = sqlstm.sqhsts;
-    sqlstm.sqpind = sqlstm.sqindv;
-    sqlstm.sqpins = sqlstm.sqinds;
-    sqlstm.sqparm = sqlstm.sqharm;
-    sqlstm.sqparc = sqlstm.sqharc;
-    sqlstm.sqpadto = sqlstm.sqadto;
-    sqlstm.sqptdso = sqlstm.sqtdso;
-    sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-    if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-
-    if (sqlca.sqlcode == 0) {
-        /* EXEC SQL COMMIT WORK; */ 
-
-{
-        struct sqlexd sqlstm;
-        sqlstm.sqlvsn = 13;
-        sqlstm.arrsiz = 5;
-        sqlstm.sqladtp = &sqladt;
-        sqlstm.sqltdsp = &sqltds;
-        sqlstm.iters = (unsigned int  )1;
-        sqlstm.offset = (unsigned int  )576;
-        sqlstm.cud = sqlcud0;
-        sqlstm.sqlest = (unsigned char  *)&sqlca;
-        sqlstm.sqlety = (unsigned short)4352;
-        sqlstm.occurs = (unsigned int  )0;
-        sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-        if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-        printf("\n\n    >>> Ű ϷǾϴ! <<<\n");
-    } else {
-        /* EXEC SQL ROLLBACK WORK; */ 
-
-{
-        struct sqlexd sqlstm;
-        sqlstm.sqlvsn = 13;
-        sqlstm.arrsiz = 5;
-        sqlstm.sqladtp = &sqladt;
-        sqlstm.sqltdsp = &sqltds;
-        sqlstm.iters = (unsigned int  )1;
-        sqlstm.offset = (unsigned int  )591;
-        sqlstm.cud = sqlcud0;
-        sqlstm.sqlest = (unsigned char  *)&sqlca;
-        sqlstm.sqlety = (unsigned short)4352;
-        sqlstm.occurs = (unsigned int  )0;
-        sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-        if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-        printf("\n\n    >>>  ! (DB ) <<<\n");
-    }
-    getch();
-}
-
-// 3.  ȸ
-void fn_my_booking()
-{
-    /* EXEC SQL BEGIN DECLARE SECTION; */ 
-
-        int input_uid; int check_user;
-    /* EXEC SQL END DECLARE SECTION; */ 
-
-    char temp[20];
-
-    clrscr();
-    printf("\n\n    [  ȸ]\n");
-    printf("    ȸ ID Էϼ: ");
-    if(fgets(temp, sizeof(temp), stdin) == NULL) return; cleanup_input(temp);
-    if(strlen(temp) == 0) return; input_uid = atoi(temp);
-
-    /* EXEC SQL SELECT count(*) INTO :check_user FROM Users WHERE user_id = :input_uid; */ 
-
-{
-    struct sqlexd sqlstm;
-    sqlstm.sqlvsn = 13;
-    sqlstm.arrsiz = 5;
-    sqlstm.sqladtp = &sqladt;
-    sqlstm.sqltdsp = &sqltds;
-    sqlstm.stmt = "select count(*)  into :b0  from Users where user_id=:b1";
-    sqlstm.iters = (unsigned int  )1;
-    sqlstm.offset = (unsigned int  )606;
-    sqlstm.selerr = (unsigned short)1;
-    sqlstm.sqlpfmem = (unsigned int  )0;
-    sqlstm.cud = sqlcud0;
-    sqlstm.sqlest = (unsigned char  *)&sqlca;
-    sqlstm.sqlety = (unsigned short)4352;
-    sqlstm.occurs = (unsigned int  )0;
-    sqlstm.sqhstv[0] = (         void  *)&check_user;
-    sqlstm.sqhstl[0] = (unsigned int  )sizeof(int);
-    sqlstm.sqhsts[0] = (         int  )0;
-    sqlstm.sqindv[0] = (         void  *)0;
-    sqlstm.sqinds[0] = (         int  )0;
-    sqlstm.sqharm[0] = (unsigned int  )0;
-    sqlstm.sqadto[0] = (unsigned short )0;
-    sqlstm.sqtdso[0] = (unsigned short )0;
-    sqlstm.sqhstv[1] = (         void  *)&input_uid;
-    sqlstm.sqhstl[1] = (unsigned int  )sizeof(int);
-    sqlstm.sqhsts[1] = (         int  )0;
-    sqlstm.sqindv[1] = (         void  *)0;
-    sqlstm.sqinds[1] = (         int  )0;
-    sqlstm.sqharm[1] = (unsigned int  )0;
-    sqlstm.sqadto[1] = (unsigned short )0;
-    sqlstm.sqtdso[1] = (unsigned short )0;
-    sqlstm.sqphsv = sqlstm.sqhstv;
-    sqlstm.sqphsl = sqlstm.sqhstl;
-    sqlstm.sqphss = sqlstm.sqhsts;
-    sqlstm.sqpind = sqlstm.sqindv;
-    sqlstm.sqpins = sqlstm.sqinds;
-    sqlstm.sqparm = sqlstm.sqharm;
-    sqlstm.sqparc = sqlstm.sqharc;
-    sqlstm.sqpadto = sqlstm.sqadto;
-    sqlstm.sqptdso = sqlstm.sqtdso;
-    sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-    if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-    if (check_user == 0) { printf("\n    >>> []  ʴ ȸ IDԴϴ.\n"); getch(); return; }
-
-    clrscr();
-    print_screen("scr_my.txt");
-    show_booking_list(input_uid, 0); 
-    
-    gotoxy(2, 28); printf("ƹ Ű  ưϴ.");
-    getch();
-}
-
-// 4.  
-void fn_change_booking()
-{
-    /* EXEC SQL BEGIN DECLARE SECTION; */ 
-
-        int target_uid; int target_bid; int new_sid; int new_seatid; int check_exists;
-        char v_errmsg[200];
-    /* EXEC SQL END DECLARE SECTION; */ 
-
-    char temp[20]; int screen_dummy; int x=30, y=7;
-
-    /* EXEC SQL COMMIT WORK; */ 
-
-{
-    struct sqlexd sqlstm;
-    sqlstm.sqlvsn = 13;
-    sqlstm.arrsiz = 5;
-    sqlstm.sqladtp = &sqladt;
-    sqlstm.sqltdsp = &sqltds;
-    sqlstm.iters = (unsigned int  )1;
-    sqlstm.offset = (unsigned int  )629;
-    sqlstm.cud = sqlcud0;
-    sqlstm.sqlest = (unsigned char  *)&sqlca;
-    sqlstm.sqlety = (unsigned short)4352;
-    sqlstm.occurs = (unsigned int  )0;
-    sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-    if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-
-    clrscr();
-    print_screen("scr_change.txt");
-    
-    // 1. ȸ ID Է
-    gotoxy(x, y);
-    if(fgets(temp, sizeof(temp), stdin) == NULL) return; cleanup_input(temp);
-    if(strlen(temp) == 0) return; target_uid = atoi(temp);
-
-    if (show_booking_list(target_uid, 1) == 0) {
-        gotoxy(5, 14); printf(">>>    ϴ."); getch(); return;
-    }
-
-    // 2.  ID Է
-    y += 2;
-    gotoxy(x, y);
-    if(fgets(temp, sizeof(temp), stdin) == NULL) return; cleanup_input(temp);
-    if(strlen(temp) == 0) return; target_bid = atoi(temp);
-
-    /* EXEC SQL SELECT count(*) INTO :check_exists FROM Bookings WHERE booking_id = :target_bid AND user_id = :target_uid; */ 
-
-{
-    struct sqlexd sqlstm;
-    sqlstm.sqlvsn = 13;
-    sqlstm.arrsiz = 5;
-    sqlstm.sqladtp = &sqladt;
-    sqlstm.sqltdsp = &sqltds;
-    sqlstm.stmt = "select count(*)  into :b0  from Bookings where (booking_i\
-d=:b1 and user_id=:b2)";
-    sqlstm.iters = (unsigned int  )1;
-    sqlstm.offset = (unsigned int  )644;
-    sqlstm.selerr = (unsigned short)1;
-    sqlstm.sqlpfmem = (unsigned int  )0;
-    sqlstm.cud = sqlcud0;
-    sqlstm.sqlest = (unsigned char  *)&sqlca;
-    sqlstm.sqlety = (unsigned short)4352;
-    sqlstm.occurs = (unsigned int  )0;
-    sqlstm.sqhstv[0] = (         void  *)&check_exists;
-    sqlstm.sqhstl[0] = (unsigned int  )sizeof(int);
-    sqlstm.sqhsts[0] = (         int  )0;
-    sqlstm.sqindv[0] = (         void  *)0;
-    sqlstm.sqinds[0] = (         int  )0;
-    sqlstm.sqharm[0] = (unsigned int  )0;
-    sqlstm.sqadto[0] = (unsigned short )0;
-    sqlstm.sqtdso[0] = (unsigned short )0;
-    sqlstm.sqhstv[1] = (         void  *)&target_bid;
-    sqlstm.sqhstl[1] = (unsigned int  )sizeof(int);
-    sqlstm.sqhsts[1] = (         int  )0;
-    sqlstm.sqindv[1] = (         void  *)0;
-    sqlstm.sqinds[1] = (         int  )0;
-    sqlstm.sqharm[1] = (unsigned int  )0;
-    sqlstm.sqadto[1] = (unsigned short )0;
-    sqlstm.sqtdso[1] = (unsigned short )0;
-    sqlstm.sqhstv[2] = (         void  *)&target_uid;
-    sqlstm.sqhstl[2] = (unsigned int  )sizeof(int);
-    sqlstm.sqhsts[2] = (         int  )0;
-    sqlstm.sqindv[2] = (         void  *)0;
-    sqlstm.sqinds[2] = (         int  )0;
-    sqlstm.sqharm[2] = (unsigned int  )0;
-    sqlstm.sqadto[2] = (unsigned short )0;
-    sqlstm.sqtdso[2] = (unsigned short )0;
-    sqlstm.sqphsv = sqlstm.sqhstv;
-    sqlstm.sqphsl = sqlstm.sqhstl;
-    sqlstm.sqphss = sqlstm.sqhsts;
-    sqlstm.sqpind = sqlstm.sqindv;
-    sqlstm.sqpins = sqlstm.sqinds;
-    sqlstm.sqparm = sqlstm.sqharm;
-    sqlstm.sqparc = sqlstm.sqharc;
-    sqlstm.sqpadto = sqlstm.sqadto;
-    sqlstm.sqptdso = sqlstm.sqtdso;
-    sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-    if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-
-    if (check_exists == 0) {
-        gotoxy(5, 14);
-        printf(">>> [] Źȣ [%d] ȸ [%d]  ƴմϴ.", target_bid, target_uid);
-        getch(); return;
-    }
-
-    gotoxy(5, 14); printf(">> Ȯ Ϸ! ͸    մϴ."); 
-    // [⼭ !] ڰ Ȯϰ ͸    (  )
-    getch(); 
-
-    // ο ȭ/   ̵
-    if (select_schedule_logic(&new_sid, &new_seatid, &screen_dummy) == 0) return;   
-
-    /* EXEC SQL UPDATE Bookings SET schedule_id = :new_sid, seat_id = :new_seatid WHERE booking_id = :target_bid; */ 
-
-{
-    struct sqlexd sqlstm;
-    sqlstm.sqlvsn = 13;
-    sqlstm.arrsiz = 5;
-    sqlstm.sqladtp = &sqladt;
-    sqlstm.sqltdsp = &sqltds;
-    sqlstm.stmt = "update Bookings  set schedule_id=:b0,seat_id=:b1 where bo\
-oking_id=:b2";
-    sqlstm.iters = (unsigned int  )1;
-    sqlstm.offset = (unsigned int  )671;
-    sqlstm.cud = sqlcud0;
-    sqlstm.sqlest = (unsigned char  *)&sqlca;
-    sqlstm.sqlety = (unsigned short)4352;
-    sqlstm.occurs = (unsigned int  )0;
-    sqlstm.sqhstv[0] = (         void  *)&new_sid;
-    sqlstm.sqhstl[0] = (unsigned int  )sizeof(int);
-    sqlstm.sqhsts[0] = (         int  )0;
-    sqlstm.sqindv[0] = (         void  *)0;
-    sqlstm.sqinds[0] = (         int  )0;
-    sqlstm.sqharm[0] = (unsigned int  )0;
-    sqlstm.sqadto[0] = (unsigned short )0;
-    sqlstm.sqtdso[0] = (unsigned short )0;
-    sqlstm.sqhstv[1] = (         void  *)&new_seatid;
-    sqlstm.sqhstl[1] = (unsigned int  )sizeof(int);
-    sqlstm.sqhsts[1] = (         int  )0;
-    sqlstm.sqindv[1] = (         void  *)0;
-    sqlstm.sqinds[1] = (         int  )0;
-    sqlstm.sqharm[1] = (unsigned int  )0;
-    sqlstm.sqadto[1] = (unsigned short )0;
-    sqlstm.sqtdso[1] = (unsigned short )0;
-    sqlstm.sqhstv[2] = (         void  *)&target_bid;
-    sqlstm.sqhstl[2] = (unsigned int  )sizeof(int);
-    sqlstm.sqhsts[2] = (         int  )0;
-    sqlstm.sqindv[2] = (         void  *)0;
-    sqlstm.sqinds[2] = (         int  )0;
-    sqlstm.sqharm[2] = (unsigned int  )0;
-    sqlstm.sqadto[2] = (unsigned short )0;
-    sqlstm.sqtdso[2] = (unsigned short )0;
-    sqlstm.sqphsv = sqlstm.sqhstv;
-    sqlstm.sqphsl = sqlstm.sqhstl;
-    sqlstm.sqphss = sqlstm.sqhsts;
-    sqlstm.sqpind = sqlstm.sqindv;
-    sqlstm.sqpins = sqlstm.sqinds;
-    sqlstm.sqparm = sqlstm.sqharm;
-    sqlstm.sqparc = sqlstm.sqharc;
-    sqlstm.sqpadto = sqlstm.sqadto;
-    sqlstm.sqptdso = sqlstm.sqtdso;
-    sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-    if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-
-    if (sqlca.sqlcode == 0) {
-        /* EXEC SQL COMMIT WORK; */ 
-
-{
-        struct sqlexd sqlstm;
-        sqlstm.sqlvsn = 13;
-        sqlstm.arrsiz = 5;
-        sqlstm.sqladtp = &sqladt;
-        sqlstm.sqltdsp = &sqltds;
-        sqlstm.iters = (unsigned int  )1;
-        sqlstm.offset = (unsigned int  )698;
-        sqlstm.cud = sqlcud0;
-        sqlstm.sqlest = (unsigned char  *)&sqlca;
-        sqlstm.sqlety = (unsigned short)4352;
-        sqlstm.occurs = (unsigned int  )0;
-        sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-        if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-        printf("\n\n    >>>   Ϸ! Ƽ ߱޵Ǿϴ. <<<\n");
-    } else {
-        /* EXEC SQL ROLLBACK WORK; */ 
-
-{
-        struct sqlexd sqlstm;
-        sqlstm.sqlvsn = 13;
-        sqlstm.arrsiz = 5;
-        sqlstm.sqladtp = &sqladt;
-        sqlstm.sqltdsp = &sqltds;
-        sqlstm.iters = (unsigned int  )1;
-        sqlstm.offset = (unsigned int  )713;
-        sqlstm.cud = sqlcud0;
-        sqlstm.sqlest = (unsigned char  *)&sqlca;
-        sqlstm.sqlety = (unsigned short)4352;
-        sqlstm.occurs = (unsigned int  )0;
-        sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-        if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-        sqlglm(v_errmsg, (size_t *)sizeof(v_errmsg), (size_t *)sizeof(v_errmsg));
-        printf("\n\n    >>>  ! (DB : %s) <<<\n", v_errmsg);
-    }
-    getch();
-}
-
-// 5.  
-void fn_cancel()
-{
-    /* EXEC SQL BEGIN DECLARE SECTION; */ 
-
-        int target_uid; int target_bid; int check_exists;
-    /* EXEC SQL END DECLARE SECTION; */ 
-
-    char temp_uid[20]; char temp_bid[20]; char yn; int x=30, y=7;
-
-    /* EXEC SQL COMMIT WORK; */ 
-
-{
-    struct sqlexd sqlstm;
-    sqlstm.sqlvsn = 13;
-    sqlstm.arrsiz = 5;
-    sqlstm.sqladtp = &sqladt;
-    sqlstm.sqltdsp = &sqltds;
-    sqlstm.iters = (unsigned int  )1;
-    sqlstm.offset = (unsigned int  )728;
-    sqlstm.cud = sqlcud0;
-    sqlstm.sqlest = (unsigned char  *)&sqlca;
-    sqlstm.sqlety = (unsigned short)4352;
-    sqlstm.occurs = (unsigned int  )0;
-    sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-    if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
- 
-
-    clrscr();
-    print_screen("scr_change.txt"); 
-    
-    gotoxy(x, y);
-    if(fgets(temp_uid, sizeof(temp_uid), stdin) == NULL) return; cleanup_input(temp_uid); 
-    if(strlen(temp_uid) == 0) return; target_uid = atoi(temp_uid);
-
-    if (show_booking_list(target_uid, 1) == 0) {
-        gotoxy(5, 14); printf(">>>    ϴ."); getch(); return;
-    }
-
-    y += 2;
-    gotoxy(x, y);
-    if(fgets(temp_bid, sizeof(temp_bid), stdin) == NULL) return; cleanup_input(temp_bid);
-    if(strlen(temp_bid) == 0) return; target_bid = atoi(temp_bid);
-
-    /* EXEC SQL SELECT count(*) INTO :check_exists FROM Bookings WHERE booking_id = :target_bid AND user_id = :target_uid; */ 
-
-{
-    struct sqlexd sqlstm;
-    sqlstm.sqlvsn = 13;
-    sqlstm.arrsiz = 5;
-    sqlstm.sqladtp = &sqladt;
-    sqlstm.sqltdsp = &sqltds;
-    sqlstm.stmt = "select count(*)  into :b0  from Bookings where (booking_i\
-d=:b1 and user_id=:b2)";
-    sqlstm.iters = (unsigned int  )1;
-    sqlstm.offset = (unsigned int  )743;
-    sqlstm.selerr = (unsigned short)1;
-    sqlstm.sqlpfmem = (unsigned int  )0;
-    sqlstm.cud = sqlcud0;
-    sqlstm.sqlest = (unsigned char  *)&sqlca;
-    sqlstm.sqlety = (unsigned short)4352;
-    sqlstm.occurs = (unsigned int  )0;
-    sqlstm.sqhstv[0] = (         void  *)&check_exists;
-    sqlstm.sqhstl[0] = (unsigned int  )sizeof(int);
-    sqlstm.sqhsts[0] = (         int  )0;
-    sqlstm.sqindv[0] = (         void  *)0;
-    sqlstm.sqinds[0] = (         int  )0;
-    sqlstm.sqharm[0] = (unsigned int  )0;
-    sqlstm.sqadto[0] = (unsigned short )0;
-    sqlstm.sqtdso[0] = (unsigned short )0;
-    sqlstm.sqhstv[1] = (         void  *)&target_bid;
-    sqlstm.sqhstl[1] = (unsigned int  )sizeof(int);
-    sqlstm.sqhsts[1] = (         int  )0;
-    sqlstm.sqindv[1] = (         void  *)0;
-    sqlstm.sqinds[1] = (         int  )0;
-    sqlstm.sqharm[1] = (unsigned int  )0;
-    sqlstm.sqadto[1] = (unsigned short )0;
-    sqlstm.sqtdso[1] = (unsigned short )0;
-    sqlstm.sqhstv[2] = (         void  *)&target_uid;
-    sqlstm.sqhstl[2] = (unsigned int  )sizeof(int);
-    sqlstm.sqhsts[2] = (         int  )0;
-    sqlstm.sqindv[2] = (         void  *)0;
-    sqlstm.sqinds[2] = (         int  )0;
-    sqlstm.sqharm[2] = (unsigned int  )0;
-    sqlstm.sqadto[2] = (unsigned short )0;
-    sqlstm.sqtdso[2] = (unsigned short )0;
-    sqlstm.sqphsv = sqlstm.sqhstv;
-    sqlstm.sqphsl = sqlstm.sqhstl;
-    sqlstm.sqphss = sqlstm.sqhsts;
-    sqlstm.sqpind = sqlstm.sqindv;
-    sqlstm.sqpins = sqlstm.sqinds;
-    sqlstm.sqparm = sqlstm.sqharm;
-    sqlstm.sqparc = sqlstm.sqharc;
-    sqlstm.sqpadto = sqlstm.sqadto;
-    sqlstm.sqptdso = sqlstm.sqtdso;
-    sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-    if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-
-    if (check_exists == 0) {
-        gotoxy(5, 14);
-        printf(">>> [] Źȣ [%d] ȸ [%d]  ƴմϴ.", target_bid, target_uid);
-        getch(); return;
-    }
-
-    gotoxy(5, 14); printf("     Ͻðڽϱ? (y/n): ");
-    yn = getchar(); while (getchar() != '\n');
-
-    if (yn == 'y' || yn == 'Y') {
-        /* EXEC SQL DELETE FROM Bookings WHERE booking_id = :target_bid; */ 
-
-{
-        struct sqlexd sqlstm;
-        sqlstm.sqlvsn = 13;
-        sqlstm.arrsiz = 5;
-        sqlstm.sqladtp = &sqladt;
-        sqlstm.sqltdsp = &sqltds;
-        sqlstm.stmt = "delete  from Bookings  where booking_id=:b0";
-        sqlstm.iters = (unsigned int  )1;
-        sqlstm.offset = (unsigned int  )770;
-        sqlstm.cud = sqlcud0;
-        sqlstm.sqlest = (unsigned char  *)&sqlca;
-        sqlstm.sqlety = (unsigned short)4352;
-        sqlstm.occurs = (unsigned int  )0;
-        sqlstm.sqhstv[0] = (         void  *)&target_bid;
-        sqlstm.sqhstl[0] = (unsigned int  )sizeof(int);
-        sqlstm.sqhsts[0] = (         int  )0;
-        sqlstm.sqindv[0] = (         void  *)0;
-        sqlstm.sqinds[0] = (         int  )0;
-        sqlstm.sqharm[0] = (unsigned int  )0;
-        sqlstm.sqadto[0] = (unsigned short )0;
-        sqlstm.sqtdso[0] = (unsigned short )0;
-        sqlstm.sqphsv = sqlstm.sqhstv;
-        sqlstm.sqphsl = sqlstm.sqhstl;
-        sqlstm.sqphss = sqlstm.sqhsts;
-        sqlstm.sqpind = sqlstm.sqindv;
-        sqlstm.sqpins = sqlstm.sqinds;
-        sqlstm.sqparm = sqlstm.sqharm;
-        sqlstm.sqparc = sqlstm.sqharc;
-        sqlstm.sqpadto = sqlstm.sqadto;
-        sqlstm.sqptdso = sqlstm.sqtdso;
-        sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-        if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-        if (sqlca.sqlcode == 0) {
-            /* EXEC SQL COMMIT WORK; */ 
-
-{
-            struct sqlexd sqlstm;
-            sqlstm.sqlvsn = 13;
-            sqlstm.arrsiz = 5;
-            sqlstm.sqladtp = &sqladt;
-            sqlstm.sqltdsp = &sqltds;
-            sqlstm.iters = (unsigned int  )1;
-            sqlstm.offset = (unsigned int  )789;
-            sqlstm.cud = sqlcud0;
-            sqlstm.sqlest = (unsigned char  *)&sqlca;
-            sqlstm.sqlety = (unsigned short)4352;
-            sqlstm.occurs = (unsigned int  )0;
-            sqlcxt((void **)0, &sqlctx, &sqlstm, &sqlfpn);
-            if (sqlca.sqlcode < 0) sql_error("\7SQL Error:");
-}
-
-
-            printf("\n    >>>  (ȯ)Ǿϴ.\n");
-        } else {
-            printf("\n    >>>   (DB ).\n");
-        }
-    }
-    getch();
-}
-
-/* ƿƼ Լ */
-void print_screen(char fname[]) {
-    FILE *fp; char line[100];
-    if ((fp = fopen(fname,"r")) == NULL) {
-        clrscr(); printf("[] UI (%s) ϴ.\n", fname); getch(); exit(-1);
-    }
-    while(fgets(line, 99, fp) != NULL) printf("%s", line);
-    fclose(fp);
-}
-
-void sql_error(char *msg) {
-    char err_msg[128]; size_t buf_len, msg_len; int x, y;
-    /* EXEC SQL WHENEVER SQLERROR CONTINUE; */ 
- 
-    getxy(&x, &y); Error_flag = 1;
-    gotoxy(1,22); printf("%s", msg);
-    buf_len = sizeof (err_msg); sqlglm(err_msg, &buf_len, &msg_len);
-    printf("%.*s\n", msg_len, err_msg); gotoxy(x, y);
-}
-
-#define STD_HANDLE GetStdHandle(STD_OUTPUT_HANDLE)
-void gotoxy(int x, int y) {
-    COORD Cur= {(SHORT)x, (SHORT) y}; SetConsoleCursorPosition(STD_HANDLE, Cur);
-}
-
-void getxy(int *x, int *y) {
-    CONSOLE_SCREEN_BUFFER_INFO Buf;
-    GetConsoleScreenBufferInfo(GetStdHandle(STD_OUTPUT_HANDLE), &Buf);
-    *x = (int)Buf.dwCursorPosition.X; *y = (int)Buf.dwCursorPosition.Y;
-}
-
-void clrscr(void) { system("cls"); gotoxy(0,0); }
\ No newline at end of file
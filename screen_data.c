@@ -0,0 +1,275 @@
+/* mkscreens  .  ġ  scr_*.txt ģ  ٽ   */
+
+#include "screens.h"
+
+static const char *const scr_change_lines[] = {
+    "------------------------------------------------------------------------------",
+    "                        [   (ȭ/) ]",
+    "------------------------------------------------------------------------------",
+    "",
+    "                 *  Ȯ   Էּ.",
+    "",
+    "                 ",
+    "                 1. ȸ ID : ",
+    "",
+    "                 2.  ID : ",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "      ----------------------------------------------------------",
+    "         [ȳ]  ġϸ ο ȭ/¼  ̵մϴ.",
+    "--------------------------------------------------------------------------------",
+};
+
+static const char *const scr_delete_lines[] = {
+    "------------------------------------------------------------------------------",
+    "                        [   (Ƽ ȯ) ]",
+    "------------------------------------------------------------------------------",
+    "",
+    "                 *     Էϼ.",
+    "",
+    "                 ",
+    "                 1. ȸ ID : ",
+    "",
+    "                 2.  ID : ",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "      ----------------------------------------------------------",
+    "            [ȳ] ҵ    ϴ.",
+    "--------------------------------------------------------------------------------",
+};
+
+static const char *const scr_insert_lines[] = {
+    "------------------------------------------------------------------------------",
+    "                        [ ȭ  (ű ) ]",
+    "------------------------------------------------------------------------------",
+    "",
+    "                            [  Էϼ]",
+    "",
+    "                            ȸ ID  :",
+    "",
+    "                             ID  :",
+    "",
+    "                            ¼ ID  :",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "--------------------------------------------------------------------------------",
+};
+
+static const char *const scr_main_lines[] = {
+    "------------------------------------------------------------------------------",
+    "                      [ ȭ  ý :  ޴ ]",
+    "------------------------------------------------------------------------------",
+    "",
+    "                        1. ȸ  (ID  )",
+    "",
+    "                        2. ȭ  ϱ",
+    "",
+    "                        3.    ȸ",
+    "",
+    "                        4.   (ȭ/ð )",
+    "",
+    "                        5.  ",
+    "",
+    "                        6. ð뺰  ȳ ( Nð)",
+    "",
+    "                        7. α׷ ",
+    "",
+    "                  ޴ ȣ Էϼ : ",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "--------------------------------------------------------------------------------",
+};
+
+static const char *const scr_movie_lines[] = {
+    "------------------------------------------------------------------------------",
+    "                       [   ȭ  ]",
+    "------------------------------------------------------------------------------",
+    "   ID       ȭ                               󿵽ð ()",
+    " -----------------------------------------------------------------------",
+    "",
+    "",
+    "",
+    "",
+    "",
+};
+
+static const char *const scr_my_lines[] = {
+    "-----------------------------------------------------------------------------------",
+    "                       [    ]",
+    "------------------------------------------------------------------------------------",
+    "   ID     ȭ                        ð           ¼          ",
+    " -----------------------------------------------------------------------------------",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "--------------------------------------------------------------------------------",
+};
+
+static const char *const scr_sch_lines[] = {
+    "------------------------------------------------------------------------------",
+    "                       [    ]",
+    "------------------------------------------------------------------------------",
+    "   ID  ȭ              󿵰 ۽ð                  ܿ",
+    " -----------------------------------------------------------------------",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+};
+
+static const char *const scr_seat_lines[] = {
+    "------------------------------------------------------------------------------",
+    "                       [ ¼  ]",
+    "------------------------------------------------------------------------------",
+    "                             [      ũ      ]",
+    " ----------------------------------------------------------------------------",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+};
+
+static const char *const scr_select_lines[] = {
+    "------------------------------------------------------------------------------",
+    "                        [   ȸ  ]",
+    "------------------------------------------------------------------------------",
+    "                           ",
+    "          ˻ ȸID :         ",
+    "          (üȸ: )",
+    "",
+    "      ID      ȸ       ȭ           ¼      ",
+    "    --------------------------------------------------------------------   ",
+    "                       ",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "--------------------------------------------------------------------------------",
+};
+
+static const char *const scr_signup_lines[] = {
+    "------------------------------------------------------------------------------",
+    "                          [ ű ȸ  ]",
+    "------------------------------------------------------------------------------",
+    "",
+    "                 * Ͻ ID  Է ּ.",
+    "",
+    "                 ",
+    "                 1.  ID : ",
+    "",
+    "                 2.     : ",
+    "",
+    "                 3. ó  : ",
+    "                    (: 010-0000-0000)",
+    "",
+    "",
+    "",
+    "      ----------------------------------------------------------",
+    "          [ȳ] Է  ͸ ġ  Ϸ˴ϴ.",
+    "--------------------------------------------------------------------------------",
+};
+
+static const char *const scr_time_lines[] = {
+    "------------------------------------------------------------------------------",
+    "                     [ ð뺰  ȳ (ü ȭ/󿵰) ]",
+    "------------------------------------------------------------------------------",
+    "",
+    "     ð   ? (1~24, =2) : ",
+    "",
+    "   ID       ȭ                  󿵰  ۽ð          ð    ",
+    " -----------------------------------------------------------------------------",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "------------------------------------------------------------------------------",
+};
+
+static const char *const scr_update_lines[] = {
+    "------------------------------------------------------------------------------",
+    "                        [     ]",
+    "------------------------------------------------------------------------------",
+    "",
+    "                               [  ȣ]",
+    "",
+    "                             ID  :",
+    "",
+    "",
+    "",
+    "     ",
+    "                          [ο ¸ Էϼ]",
+    "                        (: Ϸ, ҵ, )",
+    "",
+    "                              :",
+    "",
+    "               ",
+    "             ",
+    "",
+    "",
+    "",
+    "--------------------------------------------------------------------------------",
+};
+
+SCREEN_TEMPLATE screen_table[] = {
+    { "scr_change.txt", (int)(sizeof(scr_change_lines) / sizeof(scr_change_lines[0])), scr_change_lines, 0 },
+    { "scr_delete.txt", (int)(sizeof(scr_delete_lines) / sizeof(scr_delete_lines[0])), scr_delete_lines, 0 },
+    { "scr_insert.txt", (int)(sizeof(scr_insert_lines) / sizeof(scr_insert_lines[0])), scr_insert_lines, 0 },
+    { "scr_main.txt", (int)(sizeof(scr_main_lines) / sizeof(scr_main_lines[0])), scr_main_lines, 0 },
+    { "scr_movie.txt", (int)(sizeof(scr_movie_lines) / sizeof(scr_movie_lines[0])), scr_movie_lines, 1 },
+    { "scr_my.txt", (int)(sizeof(scr_my_lines) / sizeof(scr_my_lines[0])), scr_my_lines, 0 },
+    { "scr_sch.txt", (int)(sizeof(scr_sch_lines) / sizeof(scr_sch_lines[0])), scr_sch_lines, 1 },
+    { "scr_seat.txt", (int)(sizeof(scr_seat_lines) / sizeof(scr_seat_lines[0])), scr_seat_lines, 1 },
+    { "scr_select.txt", (int)(sizeof(scr_select_lines) / sizeof(scr_select_lines[0])), scr_select_lines, 0 },
+    { "scr_signup.txt", (int)(sizeof(scr_signup_lines) / sizeof(scr_signup_lines[0])), scr_signup_lines, 0 },
+    { "scr_time.txt", (int)(sizeof(scr_time_lines) / sizeof(scr_time_lines[0])), scr_time_lines, 1 },
+    { "scr_update.txt", (int)(sizeof(scr_update_lines) / sizeof(scr_update_lines[0])), scr_update_lines, 0 },
+};
+
+const int screen_count = 12;
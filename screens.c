@@ -0,0 +1,61 @@
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "screens.h"
+
+const SCREEN_TEMPLATE *screen_find(const char *name)
+{
+    int i;
+    for (i = 0; i < screen_count; i++)
+        if (strcmp(screen_table[i].name, name) == 0) return &screen_table[i];
+    return NULL;
+}
+
+/*  ü о   .   迭    Ҵ ( ) */
+static int load_template(SCREEN_TEMPLATE *t, const char *path)
+{
+    FILE *fp;
+    long size;
+    char *text, *p, **lines;
+    int n, i;
+
+    if ((fp = fopen(path, "rb")) == NULL) return 0;
+    fseek(fp, 0, SEEK_END);
+    size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    if (size < 0 || (text = (char *)malloc((size_t)size + 1)) == NULL) { fclose(fp); return 0; }
+    size = (long)fread(text, 1, (size_t)size, fp);
+    fclose(fp);
+    text[size] = '\0';
+
+    for (n = 1, p = text; *p; p++) if (*p == '\n' && p[1] != '\0') n++;
+    if ((lines = (char **)malloc(sizeof(char *) * n)) == NULL) { free(text); return 0; }
+
+    t->trailing_newline = (size > 0 && text[size - 1] == '\n');
+    for (i = 0, p = text; i < n; i++) {
+        size_t len = strcspn(p, "\n");
+        lines[i] = p;
+        if (len > 0 && p[len - 1] == '\r') p[len - 1] = '\0';
+        p += len;
+        if (*p == '\n') *p++ = '\0';
+    }
+    t->lines = (const char *const *)lines;
+    t->nlines = n;
+    return 1;
+}
+
+int screen_load_overrides(const char *dir)
+{
+    char path[512];
+    int i, n = 0;
+
+    if (dir == NULL || dir[0] == '\0') return 0;
+    for (i = 0; i < screen_count; i++) {
+        sprintf(path, "%.400s/%s", dir, screen_table[i].name);
+        n += load_template(&screen_table[i], path);
+    }
+    return n;
+}
@@ -0,0 +1,25 @@
+#ifndef SCREENS_H
+#define SCREENS_H
+
+/*
+ * ȭ ø (scr_*.txt)
+ *  -  Ͽ  ִ ǥ(screen_data.c, mkscreens ) ⺻ 
+ *  - screen_load_overrides(dir):    , dir  ̸   װ ٲ
+ *  -  ø   ̸   (ٹٲ  )
+ */
+
+typedef struct {
+    const char *name;               /* "scr_main.txt" */
+    int nlines;
+    const char *const *lines;
+    int trailing_newline;           /*   ٹٲ  */
+} SCREEN_TEMPLATE;
+
+/* screen_data.c ( ) */
+extern SCREEN_TEMPLATE screen_table[];
+extern const int screen_count;
+
+const SCREEN_TEMPLATE *screen_find(const char *name);
+int screen_load_overrides(const char *dir);       /* ٲ ø  */
+
+#endif
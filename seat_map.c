@@ -0,0 +1,136 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "seat_map.h"
+
+/* ¼ Ʈ popcount SSE2 (x64 ⺻ ) */
+#if defined(_M_X64) || defined(__SSE2__)
+#define USE_SSE2_POPCOUNT
+#include <emmintrin.h>
+#endif
+
+/* ¼ (row_code, col_code)  ȣ,  , ڸ  Ʈ  (ġ ٲ ) */
+void build_seat_layout(SEAT_MAP *map)
+{
+    SEAT_INFO *a, *b;
+    int i, first = 0, r = -1;
+
+    memset(map->link, 0, sizeof(map->link));
+    for (i = 0; i < map->count; i++) {
+        a = &map->seats[i];
+        if (i == 0 || strcmp(a->row, map->seats[i - 1].row) != 0) {
+            if (r >= 0 && r < MAX_SEAT_ROWS) map->row_mid2[r] = map->seats[first].col + map->seats[i - 1].col;
+            r++; first = i;
+        }
+        a->row_no = r;
+        b = (i + 1 < map->count) ? &map->seats[i + 1] : NULL;
+        if (b != NULL && strcmp(a->row, b->row) == 0 && b->col == a->col + 1) map->link[i >> 6] |= 1ULL << (i & 63);
+    }
+    if (r >= 0 && r < MAX_SEAT_ROWS) map->row_mid2[r] = map->seats[first].col + map->seats[map->count - 1].col;
+    map->nrows = r + 1;
+}
+
+int find_seat(SEAT_MAP *map, int seat_id)
+{
+    int i;
+    for (i = 0; i < map->count; i++) {
+        if (map->seats[i].seat_id == seat_id) return i;
+    }
+    return -1;
+}
+
+int seat_taken(SEAT_MAP *map, int idx)
+{
+    return (int)((map->taken[idx >> 6] >> (idx & 63)) & 1);
+}
+
+/* Ʈ 1 . SSE2 64Ʈ  徿  ó */
+int popcount_words(const unsigned long long *w, int n)
+{
+    int i = 0, total = 0;
+    unsigned long long v;
+#ifdef USE_SSE2_POPCOUNT
+    const __m128i m1 = _mm_set1_epi8(0x55), m2 = _mm_set1_epi8(0x33), m4 = _mm_set1_epi8(0x0f);
+    __m128i acc = _mm_setzero_si128(), x;
+    for (; i + 2 <= n; i += 2) {
+        x = _mm_loadu_si128((const __m128i *)(w + i));
+        x = _mm_sub_epi8(x, _mm_and_si128(_mm_srli_epi64(x, 1), m1));
+        x = _mm_add_epi8(_mm_and_si128(x, m2), _mm_and_si128(_mm_srli_epi64(x, 2), m2));
+        x = _mm_and_si128(_mm_add_epi8(x, _mm_srli_epi64(x, 4)), m4);
+        acc = _mm_add_epi64(acc, _mm_sad_epu8(x, _mm_setzero_si128()));
+    }
+    total = _mm_cvtsi128_si32(acc) + _mm_cvtsi128_si32(_mm_unpackhi_epi64(acc, acc));
+#endif
+    for (; i < n; i++) {
+        v = w[i];
+        v = v - ((v >> 1) & 0x5555555555555555ULL);
+        v = (v & 0x3333333333333333ULL) + ((v >> 2) & 0x3333333333333333ULL);
+        v = (v + (v >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+        total += (int)((v * 0x0101010101010101ULL) >> 56);
+    }
+    return total;
+}
+
+int seat_remaining(SEAT_MAP *map)
+{
+    return map->count - popcount_words(map->taken, SEAT_WORDS);
+}
+
+/* dst Ʈ i = src Ʈ i+k (¼  kĭ ,  踦 Ѿ ̾) */
+static void seat_words_shr(const unsigned long long *src, int k, unsigned long long *dst)
+{
+    int i, w = k >> 6, b = k & 63;
+    for (i = 0; i < SEAT_WORDS; i++) {
+        unsigned long long lo = (i + w < SEAT_WORDS) ? src[i + w] : 0;
+        unsigned long long hi = (i + w + 1 < SEAT_WORDS) ? src[i + w + 1] : 0;
+        dst[i] = b ? (lo >> b) | (hi << (64 - b)) : lo;
+    }
+}
+
+/*   ̾  ¼ n    ڸ.  ġ ְ out_idx n ä ( -1)
+ *   free =  ¼, run =  ¼̸鼭  ڸ ̾
+ *   "i kĭ  run" Ʈ k = 1, 2, 4, ...  AND ϸ  n-1ĭ  (log n)
+ *    ĺ = (i n-1ĭ run) & (i+n-1  ¼)
+ * :   Ÿ x 2 + ڿ 1/3   Ÿ x 3 ( ) */
+int find_seat_block(SEAT_MAP *map, int n, int *out_idx)
+{
+    unsigned long long freew[SEAT_WORDS], run[SEAT_WORDS], acc[SEAT_WORDS], tmp[SEAT_WORDS], w;
+    int i, b, k, len = 0, step = 1, m, best = -1, best_score = 0, score, ideal, r;
+
+    if (n < 1 || n > map->count) return -1;
+    for (i = 0; i < SEAT_WORDS; i++) {
+        int lo = i * 64;
+        freew[i] = ~map->taken[i];
+        if (map->count - lo < 64) freew[i] &= (map->count > lo) ? (1ULL << (map->count - lo)) - 1 : 0;
+        run[i] = freew[i] & map->link[i];
+        acc[i] = ~0ULL;
+    }
+    for (m = n - 1; m > 0; m >>= 1) {
+        if (m & 1) {
+            seat_words_shr(run, len, tmp);
+            for (i = 0; i < SEAT_WORDS; i++) acc[i] &= tmp[i];
+            len += step;
+        }
+        if (m > 1) {
+            seat_words_shr(run, step, tmp);
+            for (i = 0; i < SEAT_WORDS; i++) run[i] &= tmp[i];
+            step *= 2;
+        }
+    }
+    seat_words_shr(freew, n - 1, tmp);
+
+    ideal = map->nrows * 2 / 3;
+    for (i = 0; i < SEAT_WORDS; i++) {
+        for (w = acc[i] & tmp[i]; w != 0; w &= w - 1) {
+            for (b = 0; !((w >> b) & 1); b++) ;
+            k = i * 64 + b;
+            r = map->seats[k].row_no;
+            score = abs(map->seats[k].col + map->seats[k + n - 1].col - (r < MAX_SEAT_ROWS ? map->row_mid2[r] : 0)) * 2
+                  + abs(r - ideal) * 3;
+            if (best < 0 || score < best_score) { best = k; best_score = score; }
+        }
+    }
+    if (best < 0) return -1;
+    for (i = 0; i < n; i++) out_idx[i] = best + i;
+    return best;
+}
@@ -0,0 +1,50 @@
+#ifndef SEAT_MAP_H
+#define SEAT_MAP_H
+
+/*
+ * ¼ ġ:  ϳ ¼  +  Ʈ ޸𸮿  ٴ
+ *  - ä(load_seat_map) DB ȭ proc_sample_all.pc,  DB  Ʈ 길
+ *  - Ʈ i = seats[i] (row_code, col_code ). SEAT_WORDS 64Ʈ 
+ */
+
+#define MAX_SEATS 300
+#define SEAT_WORDS ((MAX_SEATS + 63) / 64)
+#define MAX_SEAT_ROWS 64
+
+typedef struct {
+    int  seat_id;
+    char row[5];
+    int  col;
+    int  row_no;                /* 0, row_code  */
+} SEAT_INFO;
+
+/*    : ( , ִ ORA_ROWSCN)
+ * INSERT/UPDATE   SCN ø DELETE   ̹Ƿ,  +    Ƶ SCN ٸ
+ * (Bookings ROWDEPENDENCIES    SCN. ƴϸ     ٸ  濡     ) */
+typedef struct {
+    int    cnt;
+    double scn;
+} SEAT_STAMP;
+
+typedef struct {
+    int schedule_id;
+    int screen_no;
+    int count;
+    SEAT_INFO seats[MAX_SEATS];                 /* row_code, col_code  */
+    unsigned long long taken[SEAT_WORDS];       /* Ʈ i = seats[i]   */
+    unsigned long long link[SEAT_WORDS];        /* Ʈ i = seats[i+1]   ٷ  ڸ */
+    int nrows;
+    int row_mid2[MAX_SEAT_ROWS];                /*  (ù ȣ +  ȣ) =  x 2 */
+    SEAT_STAMP stamp;
+    unsigned long checked_at;                   /*  DB 纻 ð (GetTickCount) */
+    unsigned long used_at;
+} SEAT_MAP;
+
+void build_seat_layout(SEAT_MAP *map);             /* seats[] row, col row_no, nrows, row_mid2, link ä */
+int find_seat(SEAT_MAP *map, int seat_id);          /* seats[] ġ,  -1 */
+int seat_taken(SEAT_MAP *map, int idx);
+int seat_remaining(SEAT_MAP *map);
+int popcount_words(const unsigned long long *w, int n);
+int find_seat_block(SEAT_MAP *map, int n, int *out_idx);
+
+#endif
@@ -0,0 +1,153 @@
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sql_stats.h"
+#include "trace.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#define SQL_TLS __declspec(thread)
+#define atomic_add(p, v)        InterlockedExchangeAdd64((p), (v))
+#define atomic_cas(p, old, nv)  (InterlockedCompareExchange64((p), (nv), (old)) == (old))
+#define atomic_cas_ptr(p, old, nv) (InterlockedCompareExchangePointer((PVOID volatile *)(p), (nv), (old)) == (old))
+#else
+#include <time.h>
+#define SQL_TLS __thread
+#define atomic_add(p, v)        __atomic_fetch_add((p), (v), __ATOMIC_RELAXED)
+#define atomic_cas(p, old, nv)  __sync_bool_compare_and_swap((p), (old), (nv))
+#define atomic_cas_ptr(p, old, nv) __sync_bool_compare_and_swap((p), (old), (nv))
+#endif
+
+static SQL_SITE *volatile site_list;
+static SQL_TLS long long site_t0;
+static const char *report_path;
+
+long long sql_now_us(void)
+{
+#ifdef _WIN32
+    static LARGE_INTEGER freq;
+    LARGE_INTEGER now;
+    if (freq.QuadPart == 0) QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    return (long long)((double)now.QuadPart * 1000000.0 / (double)freq.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#endif
+}
+
+void sql_begin(void)
+{
+    site_t0 = sql_now_us();
+}
+
+/* 0~3 ״,   2^e  4ĭ */
+static int bucket_of(long long us)
+{
+    int e = 0;
+    long long v;
+
+    if (us < 4) return us < 0 ? 0 : (int)us;
+    for (v = us; v > 1; v >>= 1) e++;
+    v = (e - 1) * 4 + (int)((us >> (e - 2)) & 3);
+    return v >= SQL_BUCKETS ? SQL_BUCKETS - 1 : (int)v;
+}
+
+/*  b  (us) */
+static long long bucket_top(int b)
+{
+    int e = b / 4 + 1;
+    if (b < 4) return b;
+    return ((long long)(4 + b % 4 + 1) << (e - 2)) - 1;
+}
+
+void sql_end(SQL_SITE *site, long rows)
+{
+    long long us = sql_now_us() - site_t0, m;
+    SQL_SITE *head;
+
+    if (site->linked == 0 && atomic_cas(&site->linked, 0, 1)) {
+        do {
+            head = site_list;
+            site->next = head;
+        } while (!atomic_cas_ptr(&site_list, head, site));
+    }
+    atomic_add(&site->count, 1);
+    atomic_add(&site->rows, rows > 0 ? rows : 0);
+    atomic_add(&site->total_us, us);
+    atomic_add(&site->bucket[bucket_of(us)], 1);
+    while ((m = site->max_us) < us && !atomic_cas(&site->max_us, m, us))
+        ;
+    if (trace_enabled())
+        trace_span(site->name, site->commits ? "commit" : "db", site_t0, us);
+}
+
+static long long percentile(const long long *bucket, long long count, long long max_us, double p)
+{
+    long long rank = (long long)(count * p + 0.5), seen = 0, top;
+    int b;
+
+    if (rank < 1) rank = 1;
+    for (b = 0; b < SQL_BUCKETS; b++) {
+        seen += bucket[b];
+        if (seen >= rank) {
+            top = bucket_top(b);
+            return top < max_us ? top : max_us;
+        }
+    }
+    return max_us;
+}
+
+void sql_stats_report(FILE *fp)
+{
+    SQL_SITE *s, *t, *dup;
+    long long bucket[SQL_BUCKETS], count, rows, total, max_us;
+    int b;
+
+    fprintf(fp, "%-40s %8s %9s %9s %9s %10s %10s %8s\n",
+            "site", "trips", "rows", "p50(us)", "p99(us)", "max(us)", "total(ms)", "avg(us)");
+    for (s = site_list; s != NULL; s = s->next) {
+        /*  ̸ տ ־ ̹ ļ  */
+        for (dup = site_list; dup != s && strcmp(dup->name, s->name) != 0; dup = dup->next)
+            ;
+        if (dup != s) continue;
+
+        count = rows = total = max_us = 0;
+        memset(bucket, 0, sizeof(bucket));
+        for (t = s; t != NULL; t = t->next) {
+            if (strcmp(t->name, s->name) != 0) continue;
+            count += t->count; rows += t->rows; total += t->total_us;
+            if (t->max_us > max_us) max_us = t->max_us;
+            for (b = 0; b < SQL_BUCKETS; b++) bucket[b] += t->bucket[b];
+        }
+        if (count == 0) continue;
+        fprintf(fp, "%-40s %8lld %9lld %9lld %9lld %10lld %10.1f %8lld\n", s->name, count, rows,
+                percentile(bucket, count, max_us, 0.50), percentile(bucket, count, max_us, 0.99),
+                max_us, total / 1000.0, total / count);
+    }
+}
+
+int sql_stats_write(const char *path)
+{
+    FILE *fp = fopen(path, "w");
+    if (fp == NULL) return -1;
+    sql_stats_report(fp);
+    fclose(fp);
+    return 0;
+}
+
+static void write_at_exit(void)
+{
+    sql_stats_write(report_path);
+}
+
+void sql_stats_init(const char *path)
+{
+    if (path == NULL || report_path != NULL) return;
+    report_path = path;
+    atexit(write_at_exit);
+}
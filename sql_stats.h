@@ -0,0 +1,43 @@
+#ifndef SQL_STATS_H
+#define SQL_STATS_H
+
+#include <stdio.h>
+
+/*
+ * EXEC SQL 庰 ҿ ð 
+ *  -  տ SQL_BEGIN(), ڿ SQL_END("Լ/")  
+ *  - Ʈ  SQL_SITE ϳ (ó   Ͽ ).     ( )
+ *  -  ð us  α ׷ (2 ŵ  4ĭ ,  25% ̳)
+ *  -  ̸ Ʈ   (   ROLLBACK )
+ */
+
+#define SQL_BUCKETS 128
+
+typedef struct SQL_SITE {
+    const char *name;
+    int commits;                        /* COMMIT/ROLLBACK ϴ  ( commit з) */
+    struct SQL_SITE *volatile next;
+    volatile long long linked;
+    volatile long long count;
+    volatile long long rows;
+    volatile long long total_us;
+    volatile long long max_us;
+    volatile long long bucket[SQL_BUCKETS];
+} SQL_SITE;
+
+long long sql_now_us(void);
+void sql_begin(void);                               /*     ð */
+void sql_end(SQL_SITE *site, long rows);
+void sql_stats_init(const char *path);              /*   path  (NULL̸  ) */
+int  sql_stats_write(const char *path);             /* ݱ  ٷ  */
+void sql_stats_report(FILE *fp);
+
+/* rows: DML/SELECT INTO sqlca.sqlerrd[2], 迭 FETCH ̹ պ   
+ * SQL_END_COMMIT: COMMIT/ROLLBACK , ȿ ĿԱ ϴ PL/SQL  */
+#define SQL_BEGIN()                 sql_begin()
+#define SQL_SITE_END(name, commits, n) do { static SQL_SITE sql_site_ = { name, commits }; sql_end(&sql_site_, (long)(n)); } while (0)
+#define SQL_END_ROWS(name, n)       SQL_SITE_END(name, 0, n)
+#define SQL_END(name)               SQL_SITE_END(name, 0, sqlca.sqlerrd[2])
+#define SQL_END_COMMIT(name)        SQL_SITE_END(name, 1, sqlca.sqlerrd[2])
+
+#endif
@@ -0,0 +1,462 @@
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+
+#include "term.h"
+#include "trace.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <conio.h>
+#include <io.h>
+#define isatty _isatty
+#ifndef ENABLE_VIRTUAL_TERMINAL_PROCESSING
+#define ENABLE_VIRTUAL_TERMINAL_PROCESSING 0x0004
+#endif
+#else
+#include <unistd.h>
+#include <termios.h>
+#include <sys/ioctl.h>
+#include <sys/select.h>
+#include <signal.h>
+#endif
+
+#define LINE_MAX_BYTES 512
+
+static struct {
+    char back[TERM_ROWS][TERM_COLS];        /* ׸  ȭ */
+    char front[TERM_ROWS][TERM_COLS];       /* ͹̳ο ̴ ȭ */
+    int  x, y;
+    int  fx, fy;                            /*  flush  ͹̳ Ŀ ġ */
+    int  full;                              /*  flush ü  ٽ  */
+    int  top;                               /* ͹̳ ù ٿ ̴   (â  ȭ ũѵ) */
+    int  height;                            /* ͹̳ â  */
+    int  bell;
+    int  ready;
+    void (*idle)(void);                     /* Է ٸ  idle_ms θ */
+    int  idle_ms;
+    int  mid_line;                          /* stdio ۿ д     (ٸ ʰ ٷ ) */
+#ifndef _WIN32
+    struct termios saved;                   /* term_init  ͹̳  (term_shutdown ǵ) */
+    int  raw;                               /* stdin ͹̳ raw ٲ .  Է read_line / */
+    char line[LINE_MAX_BYTES];              /* read_line  . term_getchar/term_gets տ  */
+    int  line_len, line_pos;
+#endif
+    char out[TERM_ROWS * (TERM_COLS + 24) + 256];
+} T;
+
+#ifndef _WIN32
+/* Ctrl+C    atexit  ҸǷ ⼭ ͹̳  ǵ ٽ  */
+static void restore_on_signal(int sig)
+{
+    tcsetattr(0, TCSANOW, &T.saved);
+    signal(sig, SIG_DFL);
+    raise(sig);
+}
+#endif
+
+void term_init(void)
+{
+#ifdef _WIN32
+    HANDLE h = GetStdHandle(STD_OUTPUT_HANDLE);
+    DWORD mode;
+    if (GetConsoleMode(h, &mode)) SetConsoleMode(h, mode | ENABLE_VIRTUAL_TERMINAL_PROCESSING);
+#endif
+    if (T.ready) return;
+    memset(T.back, ' ', sizeof(T.back));
+    memset(T.front, ' ', sizeof(T.front));
+    T.x = T.y = 0;
+    T.full = 1;
+    T.ready = 1;
+#ifndef _WIN32
+    /* ĳ  select   Է   -> Ű ϳ  raw ־  */
+    if (isatty(0) && tcgetattr(0, &T.saved) == 0) {
+        struct termios raw = T.saved;
+        raw.c_lflag &= ~(ICANON | ECHO);
+        raw.c_cc[VMIN] = 1; raw.c_cc[VTIME] = 0;
+        T.raw = tcsetattr(0, TCSANOW, &raw) == 0;
+        if (T.raw) {
+            signal(SIGINT, restore_on_signal);
+            signal(SIGTERM, restore_on_signal);
+            signal(SIGHUP, restore_on_signal);
+        }
+    }
+#endif
+    atexit(term_shutdown);
+}
+
+void term_shutdown(void)
+{
+    term_flush();
+#ifndef _WIN32
+    if (T.raw) tcsetattr(0, TCSANOW, &T.saved);
+    T.raw = 0;
+#endif
+}
+
+void term_clear(void)
+{
+    if (!T.ready) term_init();
+    memset(T.back, ' ', sizeof(T.back));
+    T.x = T.y = 0;
+    T.full = 1;
+}
+
+void term_goto(int x, int y)
+{
+    if (!T.ready) term_init();
+    T.x = x < 0 ? 0 : (x >= TERM_COLS ? TERM_COLS - 1 : x);
+    T.y = y < 0 ? 0 : (y >= TERM_ROWS ? TERM_ROWS - 1 : y);
+}
+
+void term_where(int *x, int *y)
+{
+    *x = T.x; *y = T.y;
+}
+
+/*  Ʒ      о ø (ܼ ũѰ ) */
+static void new_line(void)
+{
+    T.x = 0;
+    if (++T.y < TERM_ROWS) return;
+    memmove(T.back[0], T.back[1], (size_t)TERM_COLS * (TERM_ROWS - 1));
+    memset(T.back[TERM_ROWS - 1], ' ', TERM_COLS);
+    T.y = TERM_ROWS - 1;
+    T.full = 1;
+}
+
+static void put_bytes(const char *s, size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++) {
+        unsigned char c = (unsigned char)s[i];
+        if (c == '\n') { new_line(); continue; }
+        if (c == '\r') { T.x = 0; continue; }
+        if (c == '\a') { T.bell = 1; continue; }
+        if (c == '\t') {
+            do { if (T.x < TERM_COLS) T.back[T.y][T.x] = ' '; T.x++; } while (T.x % 8);
+            continue;
+        }
+        if (T.x < TERM_COLS) T.back[T.y][T.x] = (char)c;  /*   Ѵ ڴ  */
+        T.x++;
+    }
+}
+
+int term_printf(const char *fmt, ...)
+{
+    char buf[1024];
+    va_list ap;
+    int n;
+
+    if (!T.ready) term_init();
+    va_start(ap, fmt);
+    n = vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    if (n < 0) return n;
+    put_bytes(buf, (size_t)n < sizeof(buf) ? (size_t)n : sizeof(buf) - 1);
+    return n;
+}
+
+void term_puts(const char *s)
+{
+    if (!T.ready) term_init();
+    put_bytes(s, strlen(s));
+}
+
+static int row_end(const char *row)
+{
+    int n = TERM_COLS;
+    while (n > 0 && row[n - 1] == ' ') n--;
+    return n;
+}
+
+static int window_height(void)
+{
+#ifdef _WIN32
+    CONSOLE_SCREEN_BUFFER_INFO b;
+    if (GetConsoleScreenBufferInfo(GetStdHandle(STD_OUTPUT_HANDLE), &b)) return b.srWindow.Bottom - b.srWindow.Top + 1;
+#else
+    struct winsize w;
+    if (ioctl(1, TIOCGWINSZ, &w) == 0 && w.ws_row > 0) return w.ws_row;
+#endif
+    return 25;
+}
+
+/*   y â Ʒ   Ʒ ٿ ٹٲ о ø */
+static char *scroll_to(char *p, int y)
+{
+    int k = y - (T.top + T.height) + 1;
+    if (k <= 0) return p;
+    p += sprintf(p, "\x1b[%d;1H", T.height);
+    while (k-- > 0) { *p++ = '\n'; T.top++; }
+    return p;
+}
+
+/* Է ڷ  ٲ. â  Ʒ ͹̳   ũ */
+static void echo_new_line(void)
+{
+    new_line();
+    if (T.y - T.top >= T.height) T.top = T.y - T.height + 1;
+}
+
+/* ü:   ٹٲ ̾  (â  ͹̳ ˾Ƽ ũ)
+ * κ: ޶ ٸ " ̵ +  +   ".  з  ̴  ǳʶ
+ *   ü ٽ Ƿ 2Ʈ  ߰ ߸  .   write   */
+static char *emit_changes(char *p, int allow_scroll)
+{
+    int y, n, last;
+
+    if (T.full) {
+        T.height = window_height();
+        for (last = TERM_ROWS - 1; last > T.y && row_end(T.back[last]) == 0; last--) ;
+        p += sprintf(p, "\x1b[H\x1b[2J");
+        for (y = 0; y <= last; y++) {
+            n = row_end(T.back[y]);
+            memcpy(p, T.back[y], n); p += n;
+            if (y < last) { *p++ = '\r'; *p++ = '\n'; }
+        }
+        memcpy(T.front, T.back, sizeof(T.back));
+        T.top = (last + 1 > T.height) ? last + 1 - T.height : 0;
+        T.full = 0;
+        return p;
+    }
+    for (y = 0; y < TERM_ROWS; y++) {
+        if (memcmp(T.back[y], T.front[y], TERM_COLS) == 0) continue;
+        if (!allow_scroll && y >= T.top + T.height) continue;   /*  flush   */
+        memcpy(T.front[y], T.back[y], TERM_COLS);
+        if (y < T.top) continue;
+        p = scroll_to(p, y);
+        n = row_end(T.back[y]);
+        p += sprintf(p, "\x1b[%d;1H", y - T.top + 1);
+        memcpy(p, T.back[y], n); p += n;
+        p += sprintf(p, "\x1b[K");
+    }
+    return p;
+}
+
+void term_flush(void)
+{
+    char *p;
+    long long t0;
+
+    if (!T.ready) return;
+    t0 = trace_begin();
+    p = emit_changes(T.out, 1);
+    if (T.bell) { *p++ = '\a'; T.bell = 0; }
+    if (p == T.out && T.x == T.fx && T.y == T.fy) return;     /* ٲ   */
+    p = scroll_to(p, T.y);
+    p += sprintf(p, "\x1b[%d;%dH", T.y < T.top ? 1 : T.y - T.top + 1, T.x + 1);
+    T.fx = T.x; T.fy = T.y;
+
+    fwrite(T.out, 1, (size_t)(p - T.out), stdout);
+    fflush(stdout);
+    trace_end("flush", "render", t0);
+}
+
+/* Է ߿ ȭ Ϻθ ĥ : ͹̳ Ŀ /ؼ Էϴ ڸ ǵ帮  */
+void term_refresh(void)
+{
+    char *p;
+    long long t0;
+
+    if (!T.ready || T.full) return;
+    t0 = trace_begin();
+    p = T.out;
+    p += sprintf(p, "\x1b" "7");
+    p = emit_changes(p, 0);
+    if (p == T.out + 2) return;
+    p += sprintf(p, "\x1b" "8");
+    fwrite(T.out, 1, (size_t)(p - T.out), stdout);
+    fflush(stdout);
+    trace_end("refresh", "render", t0);
+}
+
+/* timeout_ms ȿ Է  1 ( ) */
+int term_key_ready(int timeout_ms)
+{
+#ifdef _WIN32
+    DWORD until = GetTickCount() + (DWORD)timeout_ms;
+    do {
+        if (_kbhit()) return 1;
+        Sleep(20);
+    } while ((long)(until - GetTickCount()) > 0);
+    return 0;
+#else
+    fd_set fds;
+    struct timeval tv;
+    FD_ZERO(&fds);
+    FD_SET(0, &fds);
+    tv.tv_sec = timeout_ms / 1000;
+    tv.tv_usec = (timeout_ms % 1000) * 1000;
+    return select(1, &fds, NULL, NULL, &tv) > 0;
+#endif
+}
+
+void term_set_idle(void (*fn)(void), int interval_ms)
+{
+    T.idle = fn;
+    T.idle_ms = interval_ms > 0 ? interval_ms : 1000;
+}
+
+/* Ű   idle . ܼ ƴϸ(, ) ׳  */
+static void idle_wait(void)
+{
+    if (T.idle == NULL || !isatty(0)) return;
+    while (!term_key_ready(T.idle_ms)) T.idle();
+}
+
+#ifndef _WIN32
+/* ͹̳ο ٷ   back/front  (flush ٽ ׸ ʵ) */
+static void echo_bytes(const char *s, int n)
+{
+    int i;
+    fwrite(s, 1, (size_t)n, stdout);
+    fflush(stdout);
+    for (i = 0; i < n; i++) {
+        if (s[i] == '\n') { echo_new_line(); continue; }
+        if (s[i] == '\b') { if (T.x > 0) T.x--; continue; }
+        if (T.x < TERM_COLS) T.back[T.y][T.x] = T.front[T.y][T.x] = s[i];
+        T.x++;
+    }
+    T.fx = T.x; T.fy = T.y;
+}
+
+/* raw   Է: , 齺̽(2Ʈ ѱ   °), ͷ ,  ٿ Ctrl+D EOF
+ * ĳ    .   T.line '\n'   */
+static int read_line(void)
+{
+    static const char erase1[] = "\b \b", erase2[] = "\b\b  \b\b";
+    char width[LINE_MAX_BYTES];             /* ڸ Ʈ  (1 Ǵ 2) */
+    int chars = 0, lead = 0;
+    unsigned char c;
+
+    T.line_len = T.line_pos = 0;
+    for (;;) {
+        if (read(0, &c, 1) != 1) return T.line_len > 0;
+        if (c == '\r' || c == '\n') {
+            if (lead) T.line_len--;         /* ¦   Ʈ  */
+            T.line[T.line_len++] = '\n';
+            echo_bytes("\n", 1);
+            return 1;
+        }
+        if (c == 4 && T.line_len == 0) return 0;
+        if (c == 127 || c == '\b') {
+            if (lead) { T.line_len--; lead = 0; continue; }
+            if (chars == 0) continue;
+            chars--;
+            T.line_len -= width[chars];
+            if (width[chars] == 2) echo_bytes(erase2, 6);
+            else echo_bytes(erase1, 3);
+            continue;
+        }
+        if (c < ' ' && !lead) continue;     /*    ڴ  */
+        if (!lead && T.line_len >= LINE_MAX_BYTES - 3) continue;
+        T.line[T.line_len++] = (char)c;
+        if (lead) {
+            lead = 0;
+            width[chars++] = 2;
+            echo_bytes(T.line + T.line_len - 2, 2);
+        } else if (c >= 0x81) {
+            lead = 1;                       /* CP949 2Ʈ   Ʈ:  Ʈ    */
+        } else {
+            width[chars++] = 1;
+            echo_bytes(T.line + T.line_len - 1, 1);
+        }
+    }
+}
+
+/* T.line    idle  ٷȴٰ    */
+static int fill_line(void)
+{
+    if (T.line_pos < T.line_len) return 1;
+    idle_wait();
+    return read_line();
+}
+#endif
+
+int term_getch(void)
+{
+    long long t0;
+    int key;
+
+    term_flush();
+    t0 = trace_begin();
+#ifdef _WIN32
+    idle_wait();
+    key = _getch();
+#else
+    {
+        unsigned char c = 0;
+        idle_wait();
+        if (read(0, &c, 1) != 1) c = '\r';
+        key = c == '\n' ? '\r' : c;
+    }
+#endif
+    trace_end("wait key", "ui", t0);
+    return key;
+}
+
+/*  Է  ڴ ͹̳ ϹǷ ۿ   */
+int term_getchar(void)
+{
+    int c;
+    long long t0;
+
+    term_flush();
+    t0 = trace_begin();
+#ifndef _WIN32
+    if (T.raw) {
+        c = fill_line() ? (unsigned char)T.line[T.line_pos++] : EOF;
+        trace_end("wait input", "ui", t0);
+        return c;
+    }
+#endif
+    if (!T.mid_line) idle_wait();
+    c = getchar();
+    trace_end("wait input", "ui", t0);
+    T.mid_line = (c != '\n' && c != EOF);
+    if (c == '\n') echo_new_line();
+    else if (c != EOF && T.x < TERM_COLS) { T.back[T.y][T.x] = T.front[T.y][T.x] = (char)c; T.x++; }
+    T.fx = T.x; T.fy = T.y;
+    return c;
+}
+
+/* ͹̳  Է ̹ ȭ鿡 Ƿ back/front  ٿ   */
+char *term_gets(char *buf, int size, FILE *fp)
+{
+    int x, n;
+    long long t0;
+
+    if (fp != stdin) return fgets(buf, size, fp);
+    term_flush();
+    t0 = trace_begin();
+#ifndef _WIN32
+    if (T.raw) {                            /* read_line ڿ  ݿ . fgetsó '\n'̳ size-1  */
+        if (size < 2 || !fill_line()) return NULL;
+        for (n = 0; n < size - 1 && T.line_pos < T.line_len; ) {
+            buf[n] = T.line[T.line_pos++];
+            if (buf[n++] == '\n') break;
+        }
+        buf[n] = '\0';
+        trace_end("wait input", "ui", t0);
+        return buf;
+    }
+#endif
+    if (!T.mid_line) idle_wait();
+    if (fgets(buf, size, fp) == NULL) return NULL;
+    trace_end("wait input", "ui", t0);
+
+    n = (int)strcspn(buf, "\r\n");
+    T.mid_line = (buf[n] != '\n' && buf[n] != '\r');
+    for (x = 0; x < n && T.x + x < TERM_COLS; x++) {
+        T.back[T.y][T.x + x] = buf[x];
+        T.front[T.y][T.x + x] = buf[x];
+    }
+    if (buf[n] == '\n' || buf[n] == '\r') echo_new_line();
+    else T.x += n;
+    T.fx = T.x; T.fy = T.y;
+    return buf;
+}
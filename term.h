@@ -0,0 +1,35 @@
+#ifndef TERM_H
+#define TERM_H
+
+#include <stdio.h>
+
+/*
+ * ͹̳   (ANSI ̽, Windows 10 ܼ /  ͹̳ )
+ *  - ȭ ޸  (back) ׸, term_flush ͹̳ο ̴ (front)
+ *    ޶ ٸ Ƽ    (write  )
+ *  - Է ޱ (term_getch, term_getchar, term_gets) ڵ flush
+ *  - term_set_idle Լ ɸ ܼ Է ٸ  ֱ θ (  )
+ *  - : term_init stdin ͹̳ raw(~ICANON, ~ECHO) ٲٰ term_shutdown(  ڵ) ǵ
+ *    Ű ϳ (term_key_ready, term_getch)   .  Է term_gets  /
+ *  - ĭ ϳ = 1Ʈ. CP949 ѱ 2Ʈ = 2ĭ̶ ״ 
+ */
+
+#define TERM_COLS 128
+#define TERM_ROWS 400     /* ¼ ó â  ȭ鵵  (â  ũ) */
+
+void term_init(void);
+void term_shutdown(void);                   /* flush  ͹̳   (term_init atexit ɾ ) */
+void term_clear(void);                      /* ۸   flush ȭ ü ٽ  */
+void term_goto(int x, int y);
+void term_where(int *x, int *y);
+int  term_printf(const char *fmt, ...);
+void term_puts(const char *s);              /*   ״ (ȭ ø ) */
+void term_flush(void);
+void term_refresh(void);                    /* Է   κ  (͹̳ Ŀ ġ ) */
+int  term_key_ready(int timeout_ms);        /*  ȿ Է  1 */
+int  term_getch(void);                      /* Ű ϳ (ʹ '\r') */
+int  term_getchar(void);                    /* stdin  Է¿   (flush ) */
+char *term_gets(char *buf, int size, FILE *fp);     /* stdin̸ flush  а, Է ڸ ۿ ݿ */
+void term_set_idle(void (*fn)(void), int interval_ms);
+
+#endif
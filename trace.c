@@ -0,0 +1,128 @@
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "trace.h"
+#include "sql_stats.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#define TRACE_TLS __declspec(thread)
+#define atomic_inc(p)           InterlockedIncrement(p)
+#define atomic_cas_ptr(p, old, nv) (InterlockedCompareExchangePointer((PVOID volatile *)(p), (nv), (old)) == (old))
+#else
+#define TRACE_TLS __thread
+#define atomic_inc(p)           __atomic_add_fetch((p), 1, __ATOMIC_RELAXED)
+#define atomic_cas_ptr(p, old, nv) __sync_bool_compare_and_swap((p), (old), (nv))
+#endif
+
+typedef struct {
+    const char *name;
+    const char *cat;
+    long long ts;
+    long long dur;
+} TRACE_EVENT;
+
+/*  ϳ  .     */
+typedef struct TRACE_BUF {
+    struct TRACE_BUF *next;
+    int tid;
+    volatile long long head;        /* ݱ   (head % TRACE_RING ڸ  ) */
+    TRACE_EVENT ev[TRACE_RING];
+} TRACE_BUF;
+
+static TRACE_BUF *volatile buf_list;
+static TRACE_TLS TRACE_BUF *my_buf;
+static volatile long next_tid;
+static const char *trace_path;
+
+static void write_at_exit(void)
+{
+    trace_write(trace_path);
+}
+
+void trace_init(const char *path)
+{
+    if (path == NULL || *path == '\0' || trace_path != NULL) return;
+    trace_path = path;
+    atexit(write_at_exit);
+}
+
+int trace_enabled(void)
+{
+    return trace_path != NULL;
+}
+
+long long trace_begin(void)
+{
+    return trace_path != NULL ? sql_now_us() : 0;
+}
+
+void trace_end(const char *name, const char *cat, long long t0)
+{
+    if (t0 == 0) return;
+    trace_span(name, cat, t0, sql_now_us() - t0);
+}
+
+static TRACE_BUF *thread_buf(void)
+{
+    TRACE_BUF *b = (TRACE_BUF *)calloc(1, sizeof(TRACE_BUF)), *head;
+
+    if (b == NULL) return NULL;
+    b->tid = (int)atomic_inc(&next_tid);
+    do {
+        head = buf_list;
+        b->next = head;
+    } while (!atomic_cas_ptr(&buf_list, head, b));
+    return b;
+}
+
+void trace_span(const char *name, const char *cat, long long ts_us, long long dur_us)
+{
+    TRACE_EVENT *e;
+
+    if (trace_path == NULL) return;
+    if (my_buf == NULL && (my_buf = thread_buf()) == NULL) return;
+    e = &my_buf->ev[my_buf->head % TRACE_RING];
+    e->name = name; e->cat = cat; e->ts = ts_us; e->dur = dur_us;
+    my_buf->head++;
+}
+
+static void put_json_str(FILE *fp, const char *s)
+{
+    fputc('"', fp);
+    for (; *s; s++) {
+        if (*s == '"' || *s == '\\') fputc('\\', fp);
+        if ((unsigned char)*s >= 0x20) fputc(*s, fp);
+    }
+    fputc('"', fp);
+}
+
+int trace_write(const char *path)
+{
+    FILE *fp;
+    TRACE_BUF *b;
+    long long i, from, head;
+    int first = 1;
+
+    if (path == NULL || (fp = fopen(path, "w")) == NULL) return -1;
+    fprintf(fp, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    for (b = buf_list; b != NULL; b = b->next) {
+        head = b->head;
+        from = head > TRACE_RING ? head - TRACE_RING : 0;
+        for (i = from; i < head; i++) {
+            TRACE_EVENT *e = &b->ev[i % TRACE_RING];
+            fprintf(fp, "%s\n{\"name\":", first ? "" : ",");
+            put_json_str(fp, e->name);
+            fprintf(fp, ",\"cat\":");
+            put_json_str(fp, e->cat);
+            fprintf(fp, ",\"ph\":\"X\",\"ts\":%lld,\"dur\":%lld,\"pid\":1,\"tid\":%d}", e->ts, e->dur, b->tid);
+            first = 0;
+        }
+    }
+    fprintf(fp, "\n]}\n");
+    fclose(fp);
+    return 0;
+}
@@ -0,0 +1,23 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+/*
+ * (span)  -> Chrome trace-event JSON (chrome://tracing, ui.perfetto.dev  )
+ *  - 帶   ϳ (TRACE_RING , ġ  ͺ ).    
+ *  - trace_init  θ ־ .   trace_begin/trace_end б ϳ
+ *  -     ۸  Ϸ 
+ *  - name, cat ڿ  (͸ )
+ *
+ * з(cat): flow = ޴ ϳ ü, ui = Է , render = ȭ , db = SQL , commit = COMMIT/ROLLBACK Ŀϴ PL/SQL  (SQL_END_COMMIT)
+ */
+
+#define TRACE_RING 8192
+
+void trace_init(const char *path);
+int  trace_enabled(void);
+long long trace_begin(void);                                    /*   0 */
+void trace_end(const char *name, const char *cat, long long t0);
+void trace_span(const char *name, const char *cat, long long ts_us, long long dur_us);
+int  trace_write(const char *path);
+
+#endif